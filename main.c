@@ -58,6 +58,10 @@
 #include "shared-module/atexit/__init__.h"
 #endif
 
+#if CIRCUITPY_AUDIOCORE
+#include "shared-module/audiocore/__init__.h"
+#endif
+
 #if CIRCUITPY_BLEIO
 #include "shared-bindings/_bleio/__init__.h"
 #include "supervisor/shared/bluetooth/bluetooth.h"
@@ -412,6 +416,11 @@ static void cleanup_after_vm(mp_obj_t exception) {
     reset_port();
     reset_board();
 
+    // Audio outputs were stopped by reset_port(), so nothing is using the shared audio buffers.
+    #if CIRCUITPY_AUDIOCORE
+    audiocore_reset();
+    #endif
+
     // Free the heap last because other modules may reference heap memory and need to shut down.
     filesystem_flush();
 
@@ -33,6 +33,41 @@
 
 #if MICROPY_ENABLE_GC
 
+#if MICROPY_GC_PARALLEL_MARK > 1
+#include <pthread.h>
+
+typedef struct {
+    void (*worker)(size_t index);
+    size_t index;
+} gc_mark_thread_t;
+
+static void *gc_mark_thread_entry(void *arg) {
+    gc_mark_thread_t *thread = arg;
+    thread->worker(thread->index);
+    return NULL;
+}
+
+void gc_parallel_mark_run(void (*worker)(size_t index), size_t n) {
+    pthread_t threads[MICROPY_GC_PARALLEL_MARK];
+    gc_mark_thread_t args[MICROPY_GC_PARALLEL_MARK];
+    bool started[MICROPY_GC_PARALLEL_MARK];
+    // This thread does the first worker's share itself.
+    for (size_t i = 1; i < n; i++) {
+        args[i].worker = worker;
+        args[i].index = i;
+        started[i] = pthread_create(&threads[i], NULL, gc_mark_thread_entry, &args[i]) == 0;
+    }
+    worker(0);
+    for (size_t i = 1; i < n; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        } else {
+            worker(i);
+        }
+    }
+}
+#endif
+
 void gc_collect(void) {
     gc_collect_start();
     gc_helper_collect_regs_and_stack();
@@ -37,6 +37,33 @@
 #define MICROPY_GC_SPLIT_HEAP          (1)
 #define MICROPY_GC_SPLIT_HEAP_N_HEAPS  (4)
 
+// Enable testing of incremental sweeping.
+#define MICROPY_GC_INCREMENTAL_SWEEP   (1)
+
+// Enable testing of the nursery.
+#define MICROPY_GC_NURSERY_BLOCKS      (64)
+
+// Enable testing of per-instruction lookup caches.
+#define MICROPY_OPT_INLINE_CACHE       (1)
+
+// Enable testing of specialised instructions.
+#define MICROPY_OPT_QUICKEN            (1)
+
+// Enable testing of maps with Robin Hood probing.
+#define MICROPY_OPT_MAP_ROBIN_HOOD     (1)
+
+// Enable testing of Montgomery modular exponentiation.
+#define MICROPY_OPT_MPZ_MONTGOMERY     (1)
+
+// Enable testing of sub-quadratic big integer algorithms.
+#define MICROPY_OPT_MPZ_SUBQUADRATIC   (1)
+
+// Enable testing of the hash table of qstrs interned at runtime.
+#define MICROPY_OPT_QSTR_INDEX         (1)
+
+// Enable testing of marking on several threads.
+#define MICROPY_GC_PARALLEL_MARK       (4)
+
 // Enable additional features.
 #define MICROPY_DEBUG_PARSE_RULE_NAME  (1)
 #define MICROPY_TRACKED_ALLOC          (1)
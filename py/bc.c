@@ -88,6 +88,25 @@ const byte *mp_decode_uint_skip(const byte *ptr) {
     return ptr;
 }
 
+#if MICROPY_OPT_QUICKEN
+const byte mp_bc_quick_generic[MP_BC_QUICK_NUM] = {
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_ADD,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_INPLACE_ADD,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_SUBTRACT,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_INPLACE_SUBTRACT,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_LESS,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_MORE,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_EQUAL,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_NOT_EQUAL,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_ADD,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_INPLACE_ADD,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_SUBTRACT,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_MULTIPLY,
+    MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_TRUE_DIVIDE,
+    MP_BC_LOAD_SUBSCR,
+};
+#endif
+
 static NORETURN void fun_pos_args_mismatch(mp_obj_fun_bc_t *f, size_t expected, size_t given) {
     #if MICROPY_ERROR_REPORTING <= MICROPY_ERROR_REPORTING_TERSE
     // generic message, used also for other argument issues
@@ -28,6 +28,7 @@
 #define MICROPY_INCLUDED_PY_BC_H
 
 #include "py/runtime.h"
+#include "py/bc0.h"
 
 // bytecode layout:
 //
@@ -279,6 +280,12 @@ mp_uint_t mp_decode_uint(const byte **ptr);
 mp_uint_t mp_decode_uint_value(const byte *ptr);
 const byte *mp_decode_uint_skip(const byte *ptr);
 
+#if MICROPY_OPT_QUICKEN
+// The generic instruction for each quickened one, indexed from MP_BC_QUICK.
+extern const byte mp_bc_quick_generic[MP_BC_QUICK_NUM];
+#define MP_BC_IS_QUICK(op) ((byte)((op) - MP_BC_QUICK) < MP_BC_QUICK_NUM)
+#endif
+
 mp_vm_return_kind_t mp_execute_bytecode(mp_code_state_t *code_state,
 #ifndef __cplusplus
     volatile
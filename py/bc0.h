@@ -159,4 +159,27 @@
 #define MP_BC_IMPORT_FROM                   (MP_BC_BASE_QSTR_O + 0x0c) // qstr
 #define MP_BC_IMPORT_STAR                   (MP_BC_BASE_BYTE_E + 0x09)
 
+// Forms of the instructions above that are specialised to the types of their
+// operands.  The compiler never emits them: the VM writes them over the generic
+// instruction in bytecode held in RAM when MICROPY_OPT_QUICKEN is enabled, and
+// writes the generic instruction back when the operands have other types.
+// They take no argument.  mp_bc_quick_generic gives the generic instruction.
+#define MP_BC_QUICK                         (0x02)
+#define MP_BC_BINARY_OP_INT_ADD             (MP_BC_QUICK + 0x00)
+#define MP_BC_BINARY_OP_INT_INPLACE_ADD     (MP_BC_QUICK + 0x01)
+#define MP_BC_BINARY_OP_INT_SUBTRACT        (MP_BC_QUICK + 0x02)
+#define MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT (MP_BC_QUICK + 0x03)
+#define MP_BC_BINARY_OP_INT_LESS            (MP_BC_QUICK + 0x04)
+#define MP_BC_BINARY_OP_INT_MORE            (MP_BC_QUICK + 0x05)
+#define MP_BC_BINARY_OP_INT_EQUAL           (MP_BC_QUICK + 0x06)
+#define MP_BC_BINARY_OP_INT_NOT_EQUAL       (MP_BC_QUICK + 0x07)
+#define MP_BC_BINARY_OP_FLOAT_ADD           (MP_BC_QUICK + 0x08)
+#define MP_BC_BINARY_OP_FLOAT_INPLACE_ADD   (MP_BC_QUICK + 0x09)
+#define MP_BC_BINARY_OP_FLOAT_SUBTRACT      (MP_BC_QUICK + 0x0a)
+#define MP_BC_BINARY_OP_FLOAT_MULTIPLY      (MP_BC_QUICK + 0x0b)
+#define MP_BC_BINARY_OP_FLOAT_TRUE_DIVIDE   (MP_BC_QUICK + 0x0c)
+#define MP_BC_LOAD_SUBSCR_LIST_INT          (MP_BC_QUICK + 0x0d)
+
+#define MP_BC_QUICK_NUM                     (14)
+
 #endif // MICROPY_INCLUDED_PY_BC0_H
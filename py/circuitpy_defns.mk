@@ -715,6 +715,7 @@ SRC_SHARED_MODULE_ALL = \
 	displayio/Palette.c \
 	displayio/TileGrid.c \
 	displayio/area.c \
+	displayio/polygon.c \
 	displayio/__init__.c \
 	dotclockframebuffer/__init__.c \
 	epaperdisplay/__init__.c \
@@ -73,6 +73,9 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_FLOAT_HIGH_QUALITY_HASH  (0)
 #define MICROPY_FLOAT_IMPL               (MICROPY_FLOAT_IMPL_FLOAT)
 #define MICROPY_GC_ALLOC_THRESHOLD       (0)
+#define MICROPY_GC_FREE_RUN_SLOTS        (CIRCUITPY_FULL_BUILD ? 4 : 0)
+#define MICROPY_GC_INCREMENTAL_SWEEP     (CIRCUITPY_FULL_BUILD)
+#define MICROPY_GC_NURSERY_BLOCKS        (CIRCUITPY_FULL_BUILD ? 64 : 0)
 #define MICROPY_GC_SPLIT_HEAP            (1)
 #define MICROPY_GC_SPLIT_HEAP_AUTO       (1)
 #define MP_PLAT_ALLOC_HEAP(size) port_malloc(size, false)
@@ -87,9 +90,15 @@ extern void common_hal_mcu_enable_interrupts(void);
 #define MICROPY_NONSTANDARD_TYPECODES    (0)
 #define MICROPY_OPT_COMPUTED_GOTO        (1)
 #define MICROPY_OPT_COMPUTED_GOTO_SAVE_SPACE (CIRCUITPY_COMPUTED_GOTO_SAVE_SPACE)
+#define MICROPY_OPT_INLINE_CACHE         (CIRCUITPY_OPT_INLINE_CACHE)
 #define MICROPY_OPT_LOAD_ATTR_FAST_PATH  (CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 #define MICROPY_OPT_MAP_LOOKUP_CACHE  (CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
+#define MICROPY_OPT_MAP_ROBIN_HOOD       (CIRCUITPY_OPT_MAP_ROBIN_HOOD)
 #define MICROPY_OPT_MPZ_BITWISE          (0)
+#define MICROPY_OPT_MPZ_MONTGOMERY       (CIRCUITPY_OPT_MPZ_MONTGOMERY)
+#define MICROPY_OPT_MPZ_SUBQUADRATIC     (CIRCUITPY_OPT_MPZ_SUBQUADRATIC)
+#define MICROPY_OPT_QSTR_INDEX           (CIRCUITPY_OPT_QSTR_INDEX)
+#define MICROPY_OPT_QUICKEN              (CIRCUITPY_OPT_QUICKEN)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (CIRCUITPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE)
 #define MICROPY_PERSISTENT_CODE_LOAD     (1)
 
@@ -417,12 +417,33 @@ CFLAGS += -DCIRCUITPY_NVM=$(CIRCUITPY_NVM)
 CIRCUITPY_ONEWIREIO ?= $(CIRCUITPY_BUSIO)
 CFLAGS += -DCIRCUITPY_ONEWIREIO=$(CIRCUITPY_ONEWIREIO)
 
+CIRCUITPY_OPT_AUDIOMIXER_KERNELS ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_AUDIOMIXER_KERNELS=$(CIRCUITPY_OPT_AUDIOMIXER_KERNELS)
+
+CIRCUITPY_OPT_INLINE_CACHE ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_INLINE_CACHE=$(CIRCUITPY_OPT_INLINE_CACHE)
+
 CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH ?= 1
 CFLAGS += -DCIRCUITPY_OPT_LOAD_ATTR_FAST_PATH=$(CIRCUITPY_OPT_LOAD_ATTR_FAST_PATH)
 
 CIRCUITPY_OPT_MAP_LOOKUP_CACHE ?= $(CIRCUITPY_FULL_BUILD)
 CFLAGS += -DCIRCUITPY_OPT_MAP_LOOKUP_CACHE=$(CIRCUITPY_OPT_MAP_LOOKUP_CACHE)
 
+CIRCUITPY_OPT_MAP_ROBIN_HOOD ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_MAP_ROBIN_HOOD=$(CIRCUITPY_OPT_MAP_ROBIN_HOOD)
+
+CIRCUITPY_OPT_MPZ_MONTGOMERY ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_MPZ_MONTGOMERY=$(CIRCUITPY_OPT_MPZ_MONTGOMERY)
+
+CIRCUITPY_OPT_MPZ_SUBQUADRATIC ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_MPZ_SUBQUADRATIC=$(CIRCUITPY_OPT_MPZ_SUBQUADRATIC)
+
+CIRCUITPY_OPT_QSTR_INDEX ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_QSTR_INDEX=$(CIRCUITPY_OPT_QSTR_INDEX)
+
+CIRCUITPY_OPT_QUICKEN ?= $(CIRCUITPY_FULL_BUILD)
+CFLAGS += -DCIRCUITPY_OPT_QUICKEN=$(CIRCUITPY_OPT_QUICKEN)
+
 CIRCUITPY_OS ?= 1
 CFLAGS += -DCIRCUITPY_OS=$(CIRCUITPY_OS)
 
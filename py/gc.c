@@ -135,6 +135,39 @@
 #define CTB_SET(area, block) do { area->gc_collect_table_start[(block) / BLOCKS_PER_CTB] |= (1 << ((block) & 7)); } while (0)
 #define CTB_CLEAR(area, block) do { area->gc_collect_table_start[(block) / BLOCKS_PER_CTB] &= (~(1 << ((block) & 7))); } while (0)
 
+// Each area is split into 32 chunks to remember where the mark stack overflowed.
+#define GC_OVERFLOW_CHUNK_BLOCKS(area) ((area)->gc_alloc_table_byte_len * BLOCKS_PER_ATB / 32 + 1)
+
+#if defined(__GNUC__)
+#define GC_PREFETCH(ptr) __builtin_prefetch(ptr)
+#else
+#define GC_PREFETCH(ptr)
+#endif
+
+#if MICROPY_GC_PARALLEL_MARK > 1
+typedef struct _gc_mark_stack_t {
+    MICROPY_GC_STACK_ENTRY_TYPE block[MICROPY_ALLOC_GC_STACK_SIZE];
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t *area[MICROPY_ALLOC_GC_STACK_SIZE];
+    #endif
+} gc_mark_stack_t;
+
+// Mark stack of a marking thread. Other threads leave this NULL and use the one in MP_STATE_MEM.
+static __thread gc_mark_stack_t *gc_mark_stack;
+#define GC_BLOCK_STACK (gc_mark_stack != NULL ? gc_mark_stack->block : MP_STATE_MEM(gc_block_stack))
+#define GC_AREA_STACK (gc_mark_stack != NULL ? gc_mark_stack->area : MP_STATE_MEM(gc_area_stack))
+
+// Marking threads share the ATB so a head is only theirs to scan if they were the one to mark it.
+static inline bool gc_try_mark(mp_state_mem_area_t *area, size_t block) {
+    byte *atb = &area->gc_alloc_table_start[block / BLOCKS_PER_ATB];
+    byte old = __atomic_fetch_or(atb, (byte)(AT_MARK << BLOCK_SHIFT(block)), __ATOMIC_RELAXED);
+    return ((old >> BLOCK_SHIFT(block)) & 3) == AT_HEAD;
+}
+#else
+#define GC_BLOCK_STACK (MP_STATE_MEM(gc_block_stack))
+#define GC_AREA_STACK (MP_STATE_MEM(gc_area_stack))
+#endif
+
 #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
 #define GC_MUTEX_INIT() mp_thread_recursive_mutex_init(&MP_STATE_MEM(gc_mutex))
 #define GC_ENTER() mp_thread_recursive_mutex_lock(&MP_STATE_MEM(gc_mutex), 1)
@@ -168,7 +201,202 @@ static void gc_mark_subtree(size_t block);
 #endif
 static void gc_deal_with_stack_overflow(void);
 static void gc_sweep_run_finalisers(void);
-static void gc_sweep_free_blocks(void);
+static void gc_sweep_start(void);
+static bool gc_sweep_free_blocks(size_t max_blocks);
+#if MICROPY_GC_INCREMENTAL_SWEEP
+static size_t gc_sweep_slice_blocks(void);
+#endif
+
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// Whether block still has the marks from the last collection. Marked heads there are in use.
+#define GC_BLOCK_UNSWEPT(area, block) ((block) >= (area)->gc_sweep_block)
+#else
+#define GC_BLOCK_UNSWEPT(area, block) (false)
+#endif
+
+#if MICROPY_GC_FREE_RUN_SLOTS
+// Each area remembers a few runs of free blocks per size class so that multi-block allocations
+// don't have to scan the allocation table from gc_last_free_atb_index. The hints are updated by
+// sweeping and freeing but not by allocating, so they are checked against the ATB before use.
+// Single blocks don't need hints because gc_last_free_atb_index already finds them quickly.
+
+static size_t gc_free_run_class(size_t n_blocks) {
+    size_t c = 0;
+    while (c < MP_GC_FREE_RUN_CLASSES - 1 && n_blocks >= ((size_t)4 << c)) {
+        c++;
+    }
+    return c;
+}
+
+static void gc_free_run_add(mp_state_mem_area_t *area, size_t start, size_t len) {
+    if (len < 2) {
+        return;
+    }
+    // When the class is full, replace the run furthest into the heap, because allocating low
+    // like the scan does keeps the top of the heap free for large blocks.
+    mp_gc_free_run_t *runs = area->gc_free_runs[gc_free_run_class(len)];
+    mp_gc_free_run_t *slot = NULL;
+    for (size_t i = 0; i < MICROPY_GC_FREE_RUN_SLOTS; i++) {
+        if (runs[i].len == 0) {
+            slot = &runs[i];
+            break;
+        }
+        if (runs[i].start > start && (slot == NULL || runs[i].start > slot->start)) {
+            slot = &runs[i];
+        }
+    }
+    if (slot != NULL) {
+        slot->start = start;
+        slot->len = len;
+    }
+}
+
+// Returns the first block of a free run of n_blocks or (size_t)-1 when no hint fits. The run is
+// removed from the hints and whatever is left of it is added back.
+static size_t gc_free_run_take(mp_state_mem_area_t *area, size_t n_blocks) {
+    size_t max_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+    for (size_t c = gc_free_run_class(n_blocks); c < MP_GC_FREE_RUN_CLASSES; c++) {
+        mp_gc_free_run_t *runs = area->gc_free_runs[c];
+        for (size_t i = 0; i < MICROPY_GC_FREE_RUN_SLOTS; i++) {
+            if (runs[i].len < n_blocks) {
+                continue;
+            }
+            size_t start = runs[i].start;
+            size_t len = runs[i].len;
+            runs[i].len = 0;
+            size_t n_free = 0;
+            while (n_free < n_blocks && start + n_free < max_block && ATB_GET_KIND(area, start + n_free) == AT_FREE) {
+                n_free++;
+            }
+            if (n_free == n_blocks) {
+                gc_free_run_add(area, start + n_blocks, len - n_blocks);
+                return start;
+            }
+            // Part of the run was allocated since it was recorded. Keep the part before it.
+            gc_free_run_add(area, start, n_free);
+        }
+    }
+    return (size_t)-1;
+}
+#endif
+
+#if MICROPY_GC_NURSERY_BLOCKS
+// Small objects without a finaliser are allocated from the nursery, a run of free blocks handed
+// out by bumping gc_nursery_block. Objects that die young are then freed together and leave long
+// runs free instead of single blocks scattered between older objects. The nursery isn't reserved
+// in the ATB so other allocations may take its blocks, and each block is checked before use.
+// Survivors stay where they are because pointers held by C code and on the stack can't be
+// updated, so the nursery is collected along with the rest of the heap.
+
+// Largest allocation taken from the nursery.
+#define GC_NURSERY_MAX_ALLOC_BLOCKS (MICROPY_GC_NURSERY_BLOCKS / 16 + 1)
+
+static void gc_nursery_reset(void) {
+    MP_STATE_MEM(gc_nursery_area) = &MP_STATE_MEM(area);
+    MP_STATE_MEM(gc_nursery_block) = 0;
+    MP_STATE_MEM(gc_nursery_end) = 0;
+}
+
+// Moves the nursery to a run of MICROPY_GC_NURSERY_BLOCKS free blocks in area, found from the
+// hints or between first_block and end_block. Returns false when there isn't one.
+static bool gc_nursery_take(mp_state_mem_area_t *area, size_t first_block, size_t end_block) {
+    size_t start_block = (size_t)-1;
+    #if MICROPY_GC_FREE_RUN_SLOTS
+    start_block = gc_free_run_take(area, MICROPY_GC_NURSERY_BLOCKS);
+    #endif
+    if (start_block == (size_t)-1) {
+        size_t n_free = 0;
+        for (size_t block = first_block; block < end_block; block++) {
+            MICROPY_GC_HOOK_LOOP(block);
+            if (ATB_GET_KIND(area, block) != AT_FREE) {
+                n_free = 0;
+            } else if (++n_free == MICROPY_GC_NURSERY_BLOCKS) {
+                start_block = block + 1 - n_free;
+                break;
+            }
+        }
+        if (start_block == (size_t)-1) {
+            return false;
+        }
+    }
+    MP_STATE_MEM(gc_nursery_area) = area;
+    MP_STATE_MEM(gc_nursery_block) = start_block;
+    MP_STATE_MEM(gc_nursery_end) = start_block + MICROPY_GC_NURSERY_BLOCKS;
+    return true;
+}
+
+// Moves the nursery to a new run of free blocks. The search carries on from the end of the
+// current nursery so each block is only looked at once between collections. When there isn't a
+// run, the nursery is unused until the next collection.
+static void gc_nursery_fill(void) {
+    mp_state_mem_area_t *area = MP_STATE_MEM(gc_nursery_area);
+    size_t first_block = MP_STATE_MEM(gc_nursery_end);
+    for (; area != NULL; area = NEXT_AREA(area), first_block = 0) {
+        first_block = MAX(first_block, area->gc_last_free_atb_index * BLOCKS_PER_ATB);
+        if (gc_nursery_take(area, first_block, area->gc_alloc_table_byte_len * BLOCKS_PER_ATB)) {
+            return;
+        }
+    }
+
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Sweeping more may free a run. The rest of the heap has just been searched, so after each
+    // slice only look at the blocks it swept, widened by enough to catch a run crossing either
+    // end. The areas are found from the list again because sweeping may free an empty one.
+    while (MP_STATE_MEM(gc_sweep_area) != NULL) {
+        mp_state_mem_area_t *swept_area = MP_STATE_MEM(gc_sweep_area);
+        size_t swept_from = swept_area->gc_sweep_block;
+        gc_sweep_free_blocks(gc_sweep_slice_blocks());
+        bool swept = false;
+        for (area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+            if (area == swept_area) {
+                swept = true;
+            } else if (!swept) {
+                continue;
+            }
+            size_t max_block = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+            size_t swept_to = area->gc_sweep_block == (size_t)-1 ? max_block : area->gc_sweep_block;
+            size_t reach = MICROPY_GC_NURSERY_BLOCKS - 1;
+            if (gc_nursery_take(area, swept_from - MIN(swept_from, reach), MIN(swept_to + reach, max_block))) {
+                return;
+            }
+            if (area == MP_STATE_MEM(gc_sweep_area)) {
+                // The slice stopped here.
+                break;
+            }
+            swept_from = 0;
+        }
+    }
+    #endif
+
+    MP_STATE_MEM(gc_nursery_area) = NULL;
+}
+
+// Returns the first of n_blocks free blocks taken from the nursery and sets *area_out, or
+// returns (size_t)-1 when the nursery can't be used.
+static size_t gc_nursery_alloc(size_t n_blocks, mp_state_mem_area_t **area_out) {
+    while (MP_STATE_MEM(gc_nursery_area) != NULL) {
+        mp_state_mem_area_t *area = MP_STATE_MEM(gc_nursery_area);
+        size_t block = MP_STATE_MEM(gc_nursery_block);
+        if (MP_STATE_MEM(gc_nursery_end) - block < n_blocks) {
+            gc_nursery_fill();
+            continue;
+        }
+        size_t n_free = 0;
+        while (n_free < n_blocks && ATB_GET_KIND(area, block + n_free) == AT_FREE) {
+            n_free++;
+        }
+        if (n_free < n_blocks) {
+            // Something else was allocated here so carry on after it.
+            MP_STATE_MEM(gc_nursery_block) = block + n_free + 1;
+            continue;
+        }
+        MP_STATE_MEM(gc_nursery_block) = block + n_blocks;
+        *area_out = area;
+        return block;
+    }
+    return (size_t)-1;
+}
+#endif
 
 // TODO waste less memory; currently requires that all entries in alloc_table have a corresponding block in pool
 static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
@@ -232,6 +460,17 @@ static void gc_setup_area(mp_state_mem_area_t *area, void *start, void *end) {
 
     area->gc_last_free_atb_index = 0;
     area->gc_last_used_block = 0;
+    area->gc_overflow_chunks = 0;
+
+    #if MICROPY_GC_FREE_RUN_SLOTS
+    memset(area->gc_free_runs, 0, sizeof(area->gc_free_runs));
+    gc_free_run_add(area, 0, gc_pool_block_len);
+    #endif
+
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    area->gc_sweep_block = (size_t)-1;
+    area->gc_sweep_last_used_block = 0;
+    #endif
 
     #if MICROPY_GC_SPLIT_HEAP
     area->next = NULL;
@@ -271,6 +510,10 @@ void gc_init(void *start, void *end) {
     MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
     #endif
 
+    #if MICROPY_GC_NURSERY_BLOCKS
+    gc_nursery_reset();
+    #endif
+
     // unlock the GC
     MP_STATE_THREAD(gc_lock_depth) = 0;
 
@@ -283,6 +526,11 @@ void gc_init(void *start, void *end) {
     MP_STATE_MEM(gc_alloc_amount) = 0;
     #endif
 
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    MP_STATE_MEM(gc_sweep_area) = NULL;
+    MP_STATE_MEM(gc_sweep_budget) = MICROPY_GC_SWEEP_BUDGET;
+    #endif
+
     GC_MUTEX_INIT();
 }
 
@@ -512,9 +760,127 @@ void gc_collect_start(void) {
 static void gc_collect_start_common(void) {
     GC_ENTER();
     assert((MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG) == 0);
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Marking needs the marks from the last collection to be gone.
+    gc_sweep_free_blocks((size_t)-1);
+    #endif
     MP_STATE_THREAD(gc_lock_depth) |= GC_COLLECT_FLAG;
     MP_STATE_MEM(gc_stack_overflow) = 0;
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        area->gc_overflow_chunks = 0;
+    }
+    #if MICROPY_GC_PARALLEL_MARK > 1
+    MP_STATE_MEM(gc_mark_root_count) = 0;
+    #endif
+    #if MICROPY_GC_NURSERY_BLOCKS
+    // Start again from the runs the sweep frees.
+    gc_nursery_reset();
+    #endif
+}
+
+#if MICROPY_GC_PARALLEL_MARK > 1
+static void gc_mark_roots_from(size_t first, size_t step) {
+    for (size_t i = first; i < MP_STATE_MEM(gc_mark_root_count); i += step) {
+        #if MICROPY_GC_SPLIT_HEAP
+        gc_mark_subtree(MP_STATE_MEM(gc_mark_root_areas)[i], MP_STATE_MEM(gc_mark_root_blocks)[i]);
+        #else
+        gc_mark_subtree(MP_STATE_MEM(gc_mark_root_blocks)[i]);
+        #endif
+    }
+}
+
+// A few roots usually lead to most of the heap, so replace roots by their children until there
+// are enough to share out between the marking threads.
+static void gc_mark_roots_expand(void) {
+    MICROPY_GC_STACK_ENTRY_TYPE *blocks = MP_STATE_MEM(gc_mark_root_blocks);
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t **areas = MP_STATE_MEM(gc_mark_root_areas);
+    #else
+    mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+    #endif
+    size_t done = 0;
+    size_t count = MP_STATE_MEM(gc_mark_root_count);
+    while (done < count && count - done < MICROPY_GC_PARALLEL_MARK * 16) {
+        size_t block = blocks[done];
+        #if MICROPY_GC_SPLIT_HEAP
+        mp_state_mem_area_t *area = areas[done];
+        #endif
+        done++;
+
+        #if MICROPY_ENABLE_SELECTIVE_COLLECT
+        if (!CTB_GET(area, block)) {
+            continue;
+        }
+        #endif
+        size_t n_blocks = 0;
+        do {
+            n_blocks += 1;
+        } while (ATB_GET_KIND(area, block + n_blocks) == AT_TAIL);
+
+        void **ptrs = (void **)PTR_FROM_BLOCK(area, block);
+        for (size_t i = n_blocks * BYTES_PER_BLOCK / sizeof(void *); i > 0; i--, ptrs++) {
+            void *ptr = *ptrs;
+            #if MICROPY_GC_SPLIT_HEAP
+            mp_state_mem_area_t *ptr_area = gc_get_ptr_area(ptr);
+            if (!ptr_area) {
+                continue;
+            }
+            #else
+            if (!VERIFY_PTR(ptr)) {
+                continue;
+            }
+            mp_state_mem_area_t *ptr_area = area;
+            #endif
+            size_t ptr_block = BLOCK_FROM_PTR(ptr_area, ptr);
+            if (ATB_GET_KIND(ptr_area, ptr_block) != AT_HEAD) {
+                continue;
+            }
+            ATB_HEAD_TO_MARK(ptr_area, ptr_block);
+            if (count < MICROPY_GC_PARALLEL_MARK_ROOTS) {
+                blocks[count] = ptr_block;
+                #if MICROPY_GC_SPLIT_HEAP
+                areas[count] = ptr_area;
+                #endif
+                count++;
+            } else {
+                #if MICROPY_GC_SPLIT_HEAP
+                gc_mark_subtree(ptr_area, ptr_block);
+                #else
+                gc_mark_subtree(ptr_block);
+                #endif
+            }
+        }
+    }
+
+    count -= done;
+    memmove(blocks, blocks + done, count * sizeof(*blocks));
+    #if MICROPY_GC_SPLIT_HEAP
+    memmove(areas, areas + done, count * sizeof(*areas));
+    #endif
+    MP_STATE_MEM(gc_mark_root_count) = count;
+}
+
+static void gc_mark_roots_worker(size_t index) {
+    gc_mark_stack_t stack;
+    gc_mark_stack = &stack;
+    gc_mark_roots_from(index, MICROPY_GC_PARALLEL_MARK);
+    gc_mark_stack = NULL;
+}
+
+// Mark everything reachable from the roots collected so far. Only the thread running the
+// collection starts marking threads because other threads give their roots from a signal handler.
+static void gc_mark_roots(bool parallel) {
+    if (parallel) {
+        gc_mark_roots_expand();
+    }
+    if (parallel && MP_STATE_MEM(gc_mark_root_count) >= MICROPY_GC_PARALLEL_MARK * 4) {
+        gc_parallel_mark_run(gc_mark_roots_worker, MICROPY_GC_PARALLEL_MARK);
+    } else {
+        gc_mark_roots_from(0, 1);
+    }
+    MP_STATE_MEM(gc_mark_root_count) = 0;
 }
+#endif
 
 void gc_collect_root(void **ptrs, size_t len) {
     #if !MICROPY_GC_SPLIT_HEAP
@@ -537,7 +903,17 @@ void gc_collect_root(void **ptrs, size_t len) {
         if (ATB_GET_KIND(area, block) == AT_HEAD) {
             // An unmarked head: mark it, and mark all its children
             ATB_HEAD_TO_MARK(area, block);
+            #if MICROPY_GC_PARALLEL_MARK > 1
+            // The marking threads start from the roots in batches.
+            size_t root = MP_STATE_MEM(gc_mark_root_count)++;
+            MP_STATE_MEM(gc_mark_root_blocks)[root] = block;
             #if MICROPY_GC_SPLIT_HEAP
+            MP_STATE_MEM(gc_mark_root_areas)[root] = area;
+            #endif
+            if (root + 1 == MICROPY_GC_PARALLEL_MARK_ROOTS) {
+                gc_mark_roots(false);
+            }
+            #elif MICROPY_GC_SPLIT_HEAP
             gc_mark_subtree(area, block);
             #else
             gc_mark_subtree(block);
@@ -558,6 +934,11 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(mp_state_mem_area_t
 static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 #endif
 {
+    MICROPY_GC_STACK_ENTRY_TYPE *block_stack = GC_BLOCK_STACK;
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t **area_stack = GC_AREA_STACK;
+    #endif
+
     // Start with the block passed in the argument.
     size_t sp = 0;
     for (;;) {
@@ -610,15 +991,32 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
                 }
                 // An unmarked head. Mark it, and push it on gc stack.
                 TRACE_MARK(ptr_block, ptr);
+                #if MICROPY_GC_PARALLEL_MARK > 1
+                if (!gc_try_mark(ptr_area, ptr_block)) {
+                    // Another thread marked it first.
+                    continue;
+                }
+                #else
                 ATB_HEAD_TO_MARK(ptr_area, ptr_block);
+                #endif
                 if (sp < MICROPY_ALLOC_GC_STACK_SIZE) {
-                    MP_STATE_MEM(gc_block_stack)[sp] = ptr_block;
+                    // It's scanned soon so start loading it.
+                    GC_PREFETCH((void *)PTR_FROM_BLOCK(ptr_area, ptr_block));
+                    block_stack[sp] = ptr_block;
                     #if MICROPY_GC_SPLIT_HEAP
-                    MP_STATE_MEM(gc_area_stack)[sp] = ptr_area;
+                    area_stack[sp] = ptr_area;
                     #endif
                     sp += 1;
                 } else {
+                    // Remember roughly where it is so its children can be found again.
+                    uint32_t chunk = (uint32_t)1 << (ptr_block / GC_OVERFLOW_CHUNK_BLOCKS(ptr_area));
+                    #if MICROPY_GC_PARALLEL_MARK > 1
+                    __atomic_fetch_or(&ptr_area->gc_overflow_chunks, chunk, __ATOMIC_RELAXED);
+                    __atomic_store_n(&MP_STATE_MEM(gc_stack_overflow), 1, __ATOMIC_RELAXED);
+                    #else
+                    ptr_area->gc_overflow_chunks |= chunk;
                     MP_STATE_MEM(gc_stack_overflow) = 1;
+                    #endif
                 }
             }
         }
@@ -630,9 +1028,9 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 
         // pop the next block off the stack
         sp -= 1;
-        block = MP_STATE_MEM(gc_block_stack)[sp];
+        block = block_stack[sp];
         #if MICROPY_GC_SPLIT_HEAP
-        area = MP_STATE_MEM(gc_area_stack)[sp];
+        area = area_stack[sp];
         #endif
     }
 }
@@ -640,12 +1038,23 @@ static void MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_mark_subtree)(size_t block)
 void gc_sweep_all(void) {
     gc_collect_start_common();
     gc_collect_end();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_finish();
+    #endif
 }
 
 void gc_collect_end(void) {
+    #if MICROPY_GC_PARALLEL_MARK > 1
+    gc_mark_roots(true);
+    #endif
     gc_deal_with_stack_overflow();
     gc_sweep_run_finalisers();
-    gc_sweep_free_blocks();
+    gc_sweep_start();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    gc_sweep_free_blocks(gc_sweep_slice_blocks());
+    #else
+    gc_sweep_free_blocks((size_t)-1);
+    #endif
     #if MICROPY_GC_SPLIT_HEAP
     MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
     #endif
@@ -660,17 +1069,27 @@ static void gc_deal_with_stack_overflow(void) {
     while (MP_STATE_MEM(gc_stack_overflow)) {
         MP_STATE_MEM(gc_stack_overflow) = 0;
 
-        // scan entire memory looking for blocks which have been marked but not their children
+        // scan the parts of memory where the stack overflowed looking for blocks which have been
+        // marked but not their children
         for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
-            for (size_t block = 0; block < area->gc_alloc_table_byte_len * BLOCKS_PER_ATB; block++) {
-                MICROPY_GC_HOOK_LOOP(block);
-                // trace (again) if mark bit set
-                if (ATB_GET_KIND(area, block) == AT_MARK) {
-                    #if MICROPY_GC_SPLIT_HEAP
-                    gc_mark_subtree(area, block);
-                    #else
-                    gc_mark_subtree(block);
-                    #endif
+            uint32_t chunks = area->gc_overflow_chunks;
+            area->gc_overflow_chunks = 0;
+            size_t chunk_blocks = GC_OVERFLOW_CHUNK_BLOCKS(area);
+            size_t total_blocks = area->gc_alloc_table_byte_len * BLOCKS_PER_ATB;
+            while (chunks != 0) {
+                size_t chunk = mp_ctz(chunks);
+                chunks &= chunks - 1;
+                size_t end_block = MIN((chunk + 1) * chunk_blocks, total_blocks);
+                for (size_t block = chunk * chunk_blocks; block < end_block; block++) {
+                    MICROPY_GC_HOOK_LOOP(block);
+                    // trace (again) if mark bit set
+                    if (ATB_GET_KIND(area, block) == AT_MARK) {
+                        #if MICROPY_GC_SPLIT_HEAP
+                        gc_mark_subtree(area, block);
+                        #else
+                        gc_mark_subtree(block);
+                        #endif
+                    }
                 }
             }
         }
@@ -719,25 +1138,65 @@ static void gc_sweep_run_finalisers(void) {
     #endif // MICROPY_ENABLE_FINALISER
 }
 
-// Free unmarked heads and their tails
-static void gc_sweep_free_blocks(void) {
+// Prepare every area to be swept from its first block.
+static void gc_sweep_start(void) {
     #if MICROPY_PY_GC_COLLECT_RETVAL
     MP_STATE_MEM(gc_collected) = 0;
     #endif
-    int free_tail = 0;
-    #if MICROPY_GC_SPLIT_HEAP_AUTO
-    mp_state_mem_area_t *prev_area = NULL;
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+        area->gc_sweep_block = 0;
+        area->gc_sweep_last_used_block = 0;
+    }
+    MP_STATE_MEM(gc_sweep_area) = &MP_STATE_MEM(area);
     #endif
+}
 
-    for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
+// Free unmarked heads and their tails. Sweeping stops at the first object boundary after
+// max_blocks blocks and the return value is false when there is more left to sweep.
+static bool gc_sweep_free_blocks(size_t max_blocks) {
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    mp_state_mem_area_t *area = MP_STATE_MEM(gc_sweep_area);
+    #else
+    mp_state_mem_area_t *area = &MP_STATE_MEM(area);
+    #endif
+
+    for (; area != NULL; area = NEXT_AREA(area)) {
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        size_t block = area->gc_sweep_block;
+        if (block == (size_t)-1) {
+            // The area was added after the collection.
+            continue;
+        }
+        size_t last_used_block = area->gc_sweep_last_used_block;
+        #else
+        size_t block = 0;
         size_t last_used_block = 0;
+        #endif
+        size_t first_freed_block = (size_t)-1;
+        int free_tail = 0;
         assert(area->gc_last_used_block <= area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
 
-        for (size_t block = 0; block <= area->gc_last_used_block; block++) {
+        #if MICROPY_GC_FREE_RUN_SLOTS
+        if (block == 0) {
+            memset(area->gc_free_runs, 0, sizeof(area->gc_free_runs));
+        }
+        size_t run_start = 0;
+        size_t run_len = 0;
+        #endif
+
+        for (; block <= area->gc_last_used_block; block++) {
             MICROPY_GC_HOOK_LOOP(block);
-            switch (ATB_GET_KIND(area, block)) {
+            byte kind = ATB_GET_KIND(area, block);
+            if (max_blocks > 0) {
+                max_blocks--;
+            } else if (kind != AT_TAIL) {
+                break;
+            }
+            switch (kind) {
                 case AT_HEAD:
                     free_tail = 1;
+                    first_freed_block = MIN(first_freed_block, block);
                     DEBUG_printf("gc_sweep_free_blocks(%p)\n", (void *)PTR_FROM_BLOCK(area, block));
                     #if MICROPY_PY_GC_COLLECT_RETVAL
                     MP_STATE_MEM(gc_collected)++;
@@ -762,22 +1221,103 @@ static void gc_sweep_free_blocks(void) {
                     last_used_block = block;
                     break;
             }
+
+            #if MICROPY_GC_FREE_RUN_SLOTS
+            if (ATB_GET_KIND(area, block) == AT_FREE) {
+                if (run_len++ == 0) {
+                    run_start = block;
+                }
+            } else {
+                gc_free_run_add(area, run_start, run_len);
+                run_len = 0;
+            }
+            #endif
+        }
+
+        #if MICROPY_GC_FREE_RUN_SLOTS
+        if (block > area->gc_last_used_block) {
+            // Everything after the old last used block was already free.
+            if (run_len == 0) {
+                run_start = block;
+            }
+            run_len += area->gc_alloc_table_byte_len * BLOCKS_PER_ATB - MIN(block, area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
+        }
+        gc_free_run_add(area, run_start, run_len);
+        #endif
+
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        // Allocations may have moved on since the collection so point them at what was freed.
+        if (first_freed_block != (size_t)-1) {
+            if (first_freed_block / BLOCKS_PER_ATB < area->gc_last_free_atb_index) {
+                area->gc_last_free_atb_index = first_freed_block / BLOCKS_PER_ATB;
+            }
+            #if MICROPY_GC_SPLIT_HEAP
+            MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
+            #endif
+        }
+
+        if (block <= area->gc_last_used_block) {
+            area->gc_sweep_block = block;
+            area->gc_sweep_last_used_block = last_used_block;
+            MP_STATE_MEM(gc_sweep_area) = area;
+            return false;
         }
+        area->gc_sweep_block = (size_t)-1;
+        #else
+        (void)first_freed_block;
+        #endif
 
         area->gc_last_used_block = last_used_block;
 
         #if MICROPY_GC_SPLIT_HEAP_AUTO
         // Free any empty area, aside from the first one
-        if (last_used_block == 0 && prev_area != NULL) {
+        if (last_used_block == 0 && area != &MP_STATE_MEM(area)) {
             DEBUG_printf("gc_sweep_free_blocks free empty area %p\n", area);
+            mp_state_mem_area_t *prev_area = &MP_STATE_MEM(area);
+            while (NEXT_AREA(prev_area) != area) {
+                prev_area = NEXT_AREA(prev_area);
+            }
             NEXT_AREA(prev_area) = NEXT_AREA(area);
+            #if MICROPY_GC_NURSERY_BLOCKS
+            if (MP_STATE_MEM(gc_nursery_area) == area) {
+                gc_nursery_reset();
+            }
+            #endif
             MP_PLAT_FREE_HEAP(area);
             area = prev_area;
+            MP_STATE_MEM(gc_last_free_area) = &MP_STATE_MEM(area);
         }
-        prev_area = area;
         #endif
     }
+
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    MP_STATE_MEM(gc_sweep_area) = NULL;
+    #endif
+    return true;
+}
+
+#if MICROPY_GC_INCREMENTAL_SWEEP
+static size_t gc_sweep_slice_blocks(void) {
+    size_t budget = MP_STATE_MEM(gc_sweep_budget);
+    return budget > 0 ? budget : (size_t)-1;
+}
+
+void gc_sweep_slice(void) {
+    // The allocation table can't change while the heap is locked.
+    if (MP_STATE_MEM(gc_sweep_area) == NULL || MP_STATE_THREAD(gc_lock_depth) > 0) {
+        return;
+    }
+    GC_ENTER();
+    gc_sweep_free_blocks(gc_sweep_slice_blocks());
+    GC_EXIT();
+}
+
+void gc_sweep_finish(void) {
+    GC_ENTER();
+    gc_sweep_free_blocks((size_t)-1);
+    GC_EXIT();
 }
+#endif
 
 // CIRCUITPY-CHANGE: add function
 void gc_collect_ptr(void *ptr) {
@@ -801,8 +1341,29 @@ static void *MP_NO_INSTRUMENT PLACE_IN_ITCM(gc_get_ptr)(void **ptrs, int i) {
     return ptrs[i];
 }
 
+// Returns the kind block will have once it has been swept, so that gc_info() is right while the
+// heap is locked with a sweep pending. *garbage is whether the object being counted is unmarked.
+static inline size_t gc_info_block_kind(mp_state_mem_area_t *area, size_t block, bool *garbage) {
+    size_t kind = ATB_GET_KIND(area, block);
+    if (GC_BLOCK_UNSWEPT(area, block)) {
+        if (kind == AT_HEAD || kind == AT_MARK) {
+            *garbage = kind == AT_HEAD;
+            kind = AT_HEAD;
+        }
+        if (*garbage) {
+            kind = AT_FREE;
+        }
+    }
+    return kind;
+}
+
 void gc_info(gc_info_t *info) {
     GC_ENTER();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    if (MP_STATE_THREAD(gc_lock_depth) == 0) {
+        gc_sweep_free_blocks((size_t)-1);
+    }
+    #endif
     info->total = 0;
     info->used = 0;
     info->free = 0;
@@ -812,10 +1373,11 @@ void gc_info(gc_info_t *info) {
     info->max_block = 0;
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
         bool finish = false;
+        bool garbage = false;
         info->total += area->gc_pool_end - area->gc_pool_start;
         for (size_t block = 0, len = 0, len_free = 0; !finish;) {
             MICROPY_GC_HOOK_LOOP(block);
-            size_t kind = ATB_GET_KIND(area, block);
+            size_t kind = gc_info_block_kind(area, block, &garbage);
             switch (kind) {
                 case AT_FREE:
                     info->free += 1;
@@ -842,7 +1404,8 @@ void gc_info(gc_info_t *info) {
             finish = (block == area->gc_alloc_table_byte_len * BLOCKS_PER_ATB);
             // Get next block type if possible
             if (!finish) {
-                kind = ATB_GET_KIND(area, block);
+                bool next_garbage = garbage;
+                kind = gc_info_block_kind(area, block, &next_garbage);
             }
 
             if (finish || kind == AT_FREE || kind == AT_HEAD) {
@@ -917,6 +1480,17 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
     }
     #endif
 
+    #if MICROPY_GC_NURSERY_BLOCKS
+    // Objects with a finaliser are usually long lived so they go in the main heap.
+    if (n_blocks <= GC_NURSERY_MAX_ALLOC_BLOCKS && !has_finaliser) {
+        start_block = gc_nursery_alloc(n_blocks, &area);
+        if (start_block != (size_t)-1) {
+            end_block = start_block + n_blocks - 1;
+            goto found_in_nursery;
+        }
+    }
+    #endif
+
     for (;;) {
 
         #if MICROPY_GC_SPLIT_HEAP
@@ -932,6 +1506,17 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
 
         // look for a run of n_blocks available blocks
         for (; area != NULL; area = NEXT_AREA(area), i = 0) {
+            #if MICROPY_GC_FREE_RUN_SLOTS
+            if (n_blocks > 1) {
+                start_block = gc_free_run_take(area, n_blocks);
+                if (start_block != (size_t)-1) {
+                    n_free = n_blocks;
+                    i = start_block + n_blocks - 1;
+                    goto found;
+                }
+            }
+            #endif
+
             n_free = 0;
             for (i = area->gc_last_free_atb_index; i < area->gc_alloc_table_byte_len; i++) {
                 MICROPY_GC_HOOK_LOOP(i);
@@ -954,6 +1539,14 @@ void *gc_alloc(size_t n_bytes, unsigned int alloc_flags) {
             #endif
         }
 
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        if (MP_STATE_MEM(gc_sweep_area) != NULL) {
+            // The rest of the last sweep may free enough.
+            gc_sweep_free_blocks((size_t)-1);
+            continue;
+        }
+        #endif
+
         GC_EXIT();
         // nothing found!
         if (collected) {
@@ -994,6 +1587,10 @@ found:
         area->gc_last_free_atb_index = (i + 1) / BLOCKS_PER_ATB;
     }
 
+    #if MICROPY_GC_NURSERY_BLOCKS
+found_in_nursery:
+    #endif
+
     // CIRCUITPY-CHANGE
     #ifdef LOG_HEAP_ACTIVITY
     gc_log_change(start_block, end_block - start_block + 1);
@@ -1004,6 +1601,14 @@ found:
     // mark first block as used head
     ATB_FREE_TO_HEAD(area, start_block);
 
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // The sweep frees unmarked heads so mark the head if the sweep hasn't got here yet.
+    if (GC_BLOCK_UNSWEPT(area, start_block)) {
+        ATB_HEAD_TO_MARK(area, start_block);
+    }
+    area->gc_sweep_last_used_block = MAX(area->gc_sweep_last_used_block, end_block);
+    #endif
+
     // mark rest of blocks as used tail
     // TODO for a run of many blocks can make this more efficient
     for (size_t bl = start_block + 1; bl <= end_block; bl++) {
@@ -1112,7 +1717,7 @@ void gc_free(void *ptr) {
 
     size_t block = BLOCK_FROM_PTR(area, ptr);
     assert(ATB_GET_KIND(area, block) == AT_HEAD
-        || (ATB_GET_KIND(area, block) == AT_MARK && (MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG)));
+        || (ATB_GET_KIND(area, block) == AT_MARK && ((MP_STATE_THREAD(gc_lock_depth) & GC_COLLECT_FLAG) || GC_BLOCK_UNSWEPT(area, block))));
 
     #if MICROPY_ENABLE_FINALISER
     FTB_CLEAR(area, block);
@@ -1144,11 +1749,25 @@ void gc_free(void *ptr) {
     #endif
 
     // free head and all of its tail blocks
+    #if MICROPY_GC_FREE_RUN_SLOTS || MICROPY_GC_NURSERY_BLOCKS
+    size_t start_block = block;
+    #endif
     do {
         ATB_ANY_TO_FREE(area, block);
         block += 1;
     } while (ATB_GET_KIND(area, block) == AT_TAIL);
 
+    #if MICROPY_GC_FREE_RUN_SLOTS
+    gc_free_run_add(area, start_block, block - start_block);
+    #endif
+
+    #if MICROPY_GC_NURSERY_BLOCKS
+    // Give the nursery back the last object it handed out, which is often a temporary.
+    if (area == MP_STATE_MEM(gc_nursery_area) && block == MP_STATE_MEM(gc_nursery_block)) {
+        MP_STATE_MEM(gc_nursery_block) = start_block;
+    }
+    #endif
+
     GC_EXIT();
 
     #if EXTENSIVE_HEAP_PROFILING
@@ -1172,7 +1791,8 @@ size_t gc_nbytes(const void *ptr) {
 
     if (area) {
         size_t block = BLOCK_FROM_PTR(area, ptr);
-        if (ATB_GET_KIND(area, block) == AT_HEAD) {
+        size_t kind = ATB_GET_KIND(area, block);
+        if (kind == AT_HEAD || (kind == AT_MARK && GC_BLOCK_UNSWEPT(area, block))) {
             // work out number of consecutive blocks in the chain starting with this on
             size_t n_blocks = 0;
             do {
@@ -1219,7 +1839,8 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
     area = &MP_STATE_MEM(area);
     #endif
     size_t block = BLOCK_FROM_PTR(area, ptr);
-    assert(ATB_GET_KIND(area, block) == AT_HEAD);
+    assert(ATB_GET_KIND(area, block) == AT_HEAD
+        || (ATB_GET_KIND(area, block) == AT_MARK && GC_BLOCK_UNSWEPT(area, block)));
 
     // compute number of new blocks that are requested
     size_t new_blocks = (n_bytes + BYTES_PER_BLOCK - 1) / BYTES_PER_BLOCK;
@@ -1263,6 +1884,10 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
             ATB_ANY_TO_FREE(area, bl);
         }
 
+        #if MICROPY_GC_FREE_RUN_SLOTS
+        gc_free_run_add(area, block + new_blocks, n_blocks - new_blocks);
+        #endif
+
         #if MICROPY_GC_SPLIT_HEAP
         if (MP_STATE_MEM(gc_last_free_area) != area) {
             // See comment in gc_free.
@@ -1303,6 +1928,9 @@ void *gc_realloc(void *ptr_in, size_t n_bytes, bool allow_move) {
         }
 
         area->gc_last_used_block = MAX(area->gc_last_used_block, end_block);
+        #if MICROPY_GC_INCREMENTAL_SWEEP
+        area->gc_sweep_last_used_block = MAX(area->gc_sweep_last_used_block, end_block);
+        #endif
 
         GC_EXIT();
 
@@ -1381,6 +2009,11 @@ void gc_dump_info(const mp_print_t *print) {
 
 void gc_dump_alloc_table(const mp_print_t *print) {
     GC_ENTER();
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    if (MP_STATE_THREAD(gc_lock_depth) == 0) {
+        gc_sweep_free_blocks((size_t)-1);
+    }
+    #endif
     static const size_t DUMP_BYTES_PER_LINE = 64;
     for (mp_state_mem_area_t *area = &MP_STATE_MEM(area); area != NULL; area = NEXT_AREA(area)) {
         #if !EXTENSIVE_HEAP_PROFILING
@@ -64,6 +64,12 @@ void gc_collect_ptr(void *ptr);
 void gc_collect_root(void **ptrs, size_t len);
 void gc_collect_end(void);
 
+#if MICROPY_GC_PARALLEL_MARK > 1
+// Provided by the port: call worker(0) to worker(n - 1) at the same time,
+// each on its own thread, and return once they have all finished.
+void gc_parallel_mark_run(void (*worker)(size_t index), size_t n);
+#endif
+
 // CIRCUITPY-CHANGE
 // Is the gc heap available?
 bool gc_alloc_possible(void);
@@ -71,6 +77,14 @@ bool gc_alloc_possible(void);
 // Use this function to sweep the whole heap and run all finalisers
 void gc_sweep_all(void);
 
+#if MICROPY_GC_INCREMENTAL_SWEEP
+// Sweep part of the heap left over from the last collection. This is cheap
+// when there is nothing to sweep so it can be called often.
+void gc_sweep_slice(void);
+// Finish sweeping the heap left over from the last collection.
+void gc_sweep_finish(void);
+#endif
+
 enum {
     GC_ALLOC_FLAG_HAS_FINALISER = 1,
     // CIRCUITPY-CHANGE
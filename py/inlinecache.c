@@ -0,0 +1,248 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include <string.h>
+
+#include "py/inlinecache.h"
+#include "py/objmodule.h"
+#include "py/objtype.h"
+#include "py/runtime.h"
+
+#if MICROPY_OPT_INLINE_CACHE
+
+// There are two kinds of entry:
+//
+// - A slot in a map that belongs to the object itself: an instance's members, a module's globals
+//   or the globals of the running code. Entries are checked against the key in the slot so they
+//   never need to be invalidated.
+//
+// - A method found in a type. The lookup can't be repeated cheaply, so the entry records
+//   MP_STATE_VM(inline_cache_version), which changes whenever any class is changed. A single
+//   version is used rather than one per class because changing a class also changes its
+//   subclasses and a class doesn't know what they are. Classes are rarely changed after they're
+//   made. Methods are only cached when the lookup depends on nothing but the type (and an
+//   instance's members, which are checked every time).
+//
+// Without a GIL, other threads may be running the same function, so entries are written under a
+// sequence count like a seqlock. A writer that finds another one in progress leaves the entry.
+
+#define INLINE_CACHE_MIN_ENTRIES (4)
+// Number of entries an instruction's entry can be in, starting from its offset in the bytecode.
+// Instructions are only a few bytes apart so they would often share an entry otherwise.
+#define INLINE_CACHE_PROBES (4)
+
+#if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
+#define INLINE_CACHE_ATOMIC (1)
+#else
+#define INLINE_CACHE_ATOMIC (0)
+#endif
+
+// Returns the entry for site in cache, or the first unused entry it could go in if there isn't one,
+// or NULL if there's neither.
+static mp_inline_cache_entry_t *inline_cache_find(const mp_obj_fun_bc_t *fun, mp_inline_cache_t *cache, const byte *site) {
+    size_t offset = site - fun->bytecode;
+    for (size_t i = 0; i < INLINE_CACHE_PROBES; i++) {
+        mp_inline_cache_entry_t *entry = &cache->entry[(offset + i) & cache->mask];
+        if (entry->site == site || entry->site == NULL) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Copies the entry for site into *out and returns whether there was one.
+static bool inline_cache_read(const mp_obj_fun_bc_t *fun, const byte *site, mp_inline_cache_entry_t *out) {
+    mp_inline_cache_t *cache = fun->inline_cache;
+    if (cache == NULL) {
+        return false;
+    }
+    const mp_inline_cache_entry_t *entry = inline_cache_find(fun, cache, site);
+    if (entry == NULL) {
+        return false;
+    }
+    #if INLINE_CACHE_ATOMIC
+    size_t seq = __atomic_load_n(&entry->seq, __ATOMIC_ACQUIRE);
+    if (seq & 1) {
+        return false;
+    }
+    *out = *entry;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&entry->seq, __ATOMIC_RELAXED) != seq) {
+        return false;
+    }
+    #else
+    *out = *entry;
+    #endif
+    return out->site == site;
+}
+
+static void inline_cache_set(mp_inline_cache_entry_t *entry, const mp_inline_cache_entry_t *value) {
+    #if INLINE_CACHE_ATOMIC
+    size_t seq = __atomic_load_n(&entry->seq, __ATOMIC_RELAXED);
+    if ((seq & 1) || !__atomic_compare_exchange_n(&entry->seq, &seq, seq + 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        return;
+    }
+    entry->site = value->site;
+    entry->type = value->type;
+    entry->method = value->method;
+    entry->aux = value->aux;
+    __atomic_store_n(&entry->seq, seq + 2, __ATOMIC_RELEASE);
+    #else
+    *entry = *value;
+    #endif
+}
+
+// Makes a table twice the size of the old one, or of INLINE_CACHE_MIN_ENTRIES when there's none,
+// and moves the old entries into it. Returns NULL if there isn't enough memory.
+static mp_inline_cache_t *inline_cache_grow(mp_obj_fun_bc_t *fun, mp_inline_cache_t *old) {
+    size_t n_entries = old == NULL ? INLINE_CACHE_MIN_ENTRIES : (old->mask + 1) * 2;
+    // Loading an attribute shouldn't fail just because the cache couldn't be made.
+    mp_inline_cache_t *cache = m_new_obj_var_maybe(mp_inline_cache_t, entry, mp_inline_cache_entry_t, n_entries);
+    if (cache == NULL) {
+        return NULL;
+    }
+    cache->mask = n_entries - 1;
+    memset(cache->entry, 0, n_entries * sizeof(mp_inline_cache_entry_t));
+    if (old != NULL) {
+        for (size_t i = 0; i <= old->mask; i++) {
+            mp_inline_cache_entry_t entry;
+            const byte *site = old->entry[i].site;
+            if (site != NULL && inline_cache_read(fun, site, &entry)) {
+                mp_inline_cache_entry_t *new_entry = inline_cache_find(fun, cache, site);
+                if (new_entry != NULL) {
+                    inline_cache_set(new_entry, &entry);
+                }
+            }
+        }
+    }
+    #if INLINE_CACHE_ATOMIC
+    __atomic_store_n(&fun->inline_cache, cache, __ATOMIC_RELEASE);
+    #else
+    fun->inline_cache = cache;
+    #endif
+    return cache;
+}
+
+static void inline_cache_write(mp_obj_fun_bc_t *fun, const byte *site, const mp_obj_type_t *type, mp_obj_t method, size_t aux) {
+    mp_inline_cache_t *cache = fun->inline_cache;
+    if (cache == NULL) {
+        cache = inline_cache_grow(fun, NULL);
+        if (cache == NULL) {
+            return;
+        }
+    }
+    mp_inline_cache_entry_t *entry = inline_cache_find(fun, cache, site);
+    if (entry == NULL && cache->mask + 1 < MICROPY_OPT_INLINE_CACHE_MAX_ENTRIES) {
+        // Other instructions are using the entries, so make room for more.
+        mp_inline_cache_t *bigger = inline_cache_grow(fun, cache);
+        if (bigger != NULL) {
+            cache = bigger;
+            entry = inline_cache_find(fun, cache, site);
+        }
+    }
+    if (entry == NULL) {
+        // The table is as big as it gets so take the first entry from whoever has it.
+        entry = &cache->entry[(site - fun->bytecode) & cache->mask];
+    }
+    mp_inline_cache_entry_t value = {
+        .site = site,
+        .type = type,
+        .method = method,
+        .aux = aux,
+    };
+    inline_cache_set(entry, &value);
+}
+
+// Returns the map holding the attributes that belong to base itself, or NULL if it hasn't got one.
+static mp_map_t *inline_cache_own_map(mp_obj_t base, const mp_obj_type_t *type) {
+    if (mp_obj_is_instance_type(type)) {
+        return &((mp_obj_instance_t *)MP_OBJ_TO_PTR(base))->members;
+    }
+    if (type == &mp_type_module) {
+        return &((mp_obj_module_t *)MP_OBJ_TO_PTR(base))->globals->map;
+    }
+    return NULL;
+}
+
+static inline mp_map_elem_t *inline_cache_get_slot(mp_map_t *map, size_t slot, qstr attr) {
+    if (slot < map->alloc && map->table[slot].key == MP_OBJ_NEW_QSTR(attr)) {
+        return &map->table[slot];
+    }
+    return NULL;
+}
+
+void mp_inline_cache_load_method(mp_obj_fun_bc_t *fun, const byte *site, mp_obj_t base, qstr attr, mp_obj_t *dest) {
+    const mp_obj_type_t *type = mp_obj_get_type(base);
+    size_t version = MP_STATE_VM(inline_cache_version);
+    mp_inline_cache_entry_t entry;
+    if (inline_cache_read(fun, site, &entry) && entry.type == type) {
+        mp_map_t *map = inline_cache_own_map(base, type);
+        if (entry.method == MP_OBJ_NULL) {
+            mp_map_elem_t *elem = inline_cache_get_slot(map, entry.aux, attr);
+            if (elem != NULL) {
+                dest[0] = elem->value;
+                dest[1] = MP_OBJ_NULL;
+                return;
+            }
+        } else if (entry.aux == version
+                   && (map == NULL || mp_map_lookup(map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP) == NULL)) {
+            dest[0] = entry.method;
+            dest[1] = base;
+            return;
+        }
+    }
+
+    mp_load_method(base, attr, dest);
+
+    #if MICROPY_CPYTHON_COMPAT
+    if (attr == MP_QSTR___class__) {
+        // Found without looking in the object's map even if it has the name.
+        return;
+    }
+    #endif
+    mp_map_t *map = inline_cache_own_map(base, type);
+    if (dest[1] == MP_OBJ_NULL) {
+        if (map != NULL) {
+            mp_map_elem_t *elem = mp_map_lookup(map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
+            if (elem != NULL && elem->value == dest[0]) {
+                inline_cache_write(fun, site, type, MP_OBJ_NULL, elem - map->table);
+            }
+        }
+    } else if (dest[1] == base && (map != NULL ? mp_obj_is_instance_type(type) : !MP_OBJ_TYPE_HAS_SLOT(type, attr))) {
+        // The method came from the class of an instance or from the locals dict of a type that
+        // doesn't look up attributes itself. Methods of native bases bind something else as self.
+        inline_cache_write(fun, site, type, dest[0], version);
+    }
+}
+
+mp_obj_t mp_inline_cache_load_attr(mp_obj_fun_bc_t *fun, const byte *site, mp_obj_t base, qstr attr) {
+    mp_obj_t dest[2];
+    mp_inline_cache_load_method(fun, site, base, attr, dest);
+    if (dest[1] == MP_OBJ_NULL) {
+        return dest[0];
+    }
+    return mp_obj_new_bound_meth(dest[0], dest[1]);
+}
+
+mp_obj_t mp_inline_cache_load_global(mp_obj_fun_bc_t *fun, const byte *site, qstr qst) {
+    mp_map_t *map = &mp_globals_get()->map;
+    mp_inline_cache_entry_t entry;
+    if (inline_cache_read(fun, site, &entry)) {
+        mp_map_elem_t *elem = inline_cache_get_slot(map, entry.aux, qst);
+        if (elem != NULL) {
+            return elem->value;
+        }
+    }
+    // Only globals are cached. Builtins would have to be checked for being shadowed every time.
+    mp_map_elem_t *elem = mp_map_lookup(map, MP_OBJ_NEW_QSTR(qst), MP_MAP_LOOKUP);
+    if (elem == NULL) {
+        return mp_load_global(qst);
+    }
+    inline_cache_write(fun, site, NULL, MP_OBJ_NULL, elem - map->table);
+    return elem->value;
+}
+
+#endif // MICROPY_OPT_INLINE_CACHE
@@ -0,0 +1,41 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "py/objfun.h"
+
+#if MICROPY_OPT_INLINE_CACHE
+
+// Each LOAD_ATTR, LOAD_METHOD and LOAD_GLOBAL instruction that runs remembers where it found its
+// name in an entry of a table attached to the function object. The entry is found from where the
+// instruction is in the bytecode, so instructions don't push each other out unless the function
+// has more of them than the table can grow to.
+
+typedef struct _mp_inline_cache_entry_t {
+    const byte *site; // Instruction the entry is for, NULL when unused.
+    const mp_obj_type_t *type; // Type of the object the name was loaded from.
+    // A method found in the type that binds the object as self, or MP_OBJ_NULL when the name was
+    // found in the object's own map.
+    mp_obj_t method;
+    size_t aux; // inline_cache_version for a method, otherwise the slot in the map.
+    #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
+    size_t seq; // Odd while the entry is being written.
+    #endif
+} mp_inline_cache_entry_t;
+
+typedef struct _mp_inline_cache_t {
+    size_t mask; // Number of entries minus one.
+    mp_inline_cache_entry_t entry[];
+} mp_inline_cache_t;
+
+// These behave like mp_load_attr, mp_load_method and mp_load_global. site is the instruction
+// doing the load and must be in fun's bytecode.
+mp_obj_t mp_inline_cache_load_attr(mp_obj_fun_bc_t *fun, const byte *site, mp_obj_t base, qstr attr);
+void mp_inline_cache_load_method(mp_obj_fun_bc_t *fun, const byte *site, mp_obj_t base, qstr attr, mp_obj_t *dest);
+mp_obj_t mp_inline_cache_load_global(mp_obj_fun_bc_t *fun, const byte *site, qstr qst);
+
+#endif // MICROPY_OPT_INLINE_CACHE
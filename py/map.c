@@ -86,8 +86,138 @@ static size_t get_hash_alloc_greater_or_equal_to(size_t x) {
 /******************************************************************************/
 /* map                                                                        */
 
+#if MICROPY_OPT_MAP_ROBIN_HOOD
+// A map that isn't ordered keeps its entries in map->table in the order they
+// were added. Removing one leaves a hole, with the key MP_OBJ_SENTINEL, until
+// the map is next rehashed. The same allocation holds, after the entries:
+//  - the number of entries that have been used, including holes
+//  - the hash of the key of each entry
+//  - a power of two buckets, more than there are entries, each holding the
+//    index of an entry plus one, or zero when it's empty. The buckets are
+//    one, two or four bytes each depending on how many entries there are.
+// An entry goes in the first empty bucket from its home bucket. With Robin
+// Hood probing an entry that's being added takes the bucket of any entry that
+// is nearer its own home, and that entry moves on instead. So a lookup can
+// stop at the first bucket whose entry is nearer its home than the key being
+// looked for would be there.
+
+typedef uint32_t map_hash_t;
+
+static inline size_t map_buckets_log2(size_t alloc) {
+    return 32 - mp_clz((uint32_t)alloc);
+}
+
+static inline size_t map_bucket_bytes(size_t alloc) {
+    return alloc < 0xff ? 1 : alloc < 0xffff ? 2 : 4;
+}
+
+static size_t map_table_bytes(size_t alloc) {
+    if (alloc == 0) {
+        return 0;
+    }
+    return alloc * (sizeof(mp_map_elem_t) + sizeof(map_hash_t)) + sizeof(size_t)
+           + ((size_t)1 << map_buckets_log2(alloc)) * map_bucket_bytes(alloc);
+}
+
+static inline size_t *map_filled(const mp_map_t *map) {
+    return (size_t *)(map->table + map->alloc);
+}
+
+static inline map_hash_t *map_hashes(const mp_map_t *map) {
+    return (map_hash_t *)(map_filled(map) + 1);
+}
+
+static inline uint8_t *map_buckets(const mp_map_t *map) {
+    return (uint8_t *)(map_hashes(map) + map->alloc);
+}
+
+static inline size_t map_bucket_get(const uint8_t *buckets, size_t bytes, size_t pos) {
+    if (bytes == 1) {
+        return buckets[pos];
+    } else if (bytes == 2) {
+        return ((const uint16_t *)buckets)[pos];
+    } else {
+        return ((const uint32_t *)buckets)[pos];
+    }
+}
+
+static inline void map_bucket_set(uint8_t *buckets, size_t bytes, size_t pos, size_t value) {
+    if (bytes == 1) {
+        buckets[pos] = value;
+    } else if (bytes == 2) {
+        ((uint16_t *)buckets)[pos] = value;
+    } else {
+        ((uint32_t *)buckets)[pos] = value;
+    }
+}
+
+// Fibonacci hashing spreads out hashes that only differ in their high bits,
+// such as those of objects hashed by address.
+static inline size_t map_home(map_hash_t hash, size_t log2) {
+    return (map_hash_t)(hash * 2654435769u) >> (32 - log2);
+}
+
+// Puts entry (plus one) in the buckets, starting at bucket pos which is dist
+// from its home bucket.
+static void map_bucket_insert(const mp_map_t *map, size_t pos, size_t dist, size_t entry) {
+    size_t log2 = map_buckets_log2(map->alloc);
+    size_t mask = ((size_t)1 << log2) - 1;
+    size_t bytes = map_bucket_bytes(map->alloc);
+    uint8_t *buckets = map_buckets(map);
+    const map_hash_t *hashes = map_hashes(map);
+    for (;; pos = (pos + 1) & mask, dist++) {
+        size_t other = map_bucket_get(buckets, bytes, pos);
+        if (other == 0) {
+            map_bucket_set(buckets, bytes, pos, entry);
+            return;
+        }
+        size_t other_dist = (pos - map_home(hashes[other - 1], log2)) & mask;
+        if (other_dist < dist) {
+            map_bucket_set(buckets, bytes, pos, entry);
+            entry = other;
+            dist = other_dist;
+        }
+    }
+}
+
+// Empties bucket pos, moving back the entries after it that aren't in their
+// home bucket.
+static void map_bucket_remove(const mp_map_t *map, size_t pos) {
+    size_t log2 = map_buckets_log2(map->alloc);
+    size_t mask = ((size_t)1 << log2) - 1;
+    size_t bytes = map_bucket_bytes(map->alloc);
+    uint8_t *buckets = map_buckets(map);
+    const map_hash_t *hashes = map_hashes(map);
+    for (;;) {
+        size_t next = (pos + 1) & mask;
+        size_t entry = map_bucket_get(buckets, bytes, next);
+        if (entry == 0 || map_home(hashes[entry - 1], log2) == next) {
+            break;
+        }
+        map_bucket_set(buckets, bytes, pos, entry);
+        pos = next;
+    }
+    map_bucket_set(buckets, bytes, pos, 0);
+}
+
+#define malloc_table(num) ((mp_map_elem_t *)m_malloc0(map_table_bytes(num)))
+#define free_table(map) m_del(byte, (map)->table, mp_map_table_size(map))
+
+size_t mp_map_table_size(const mp_map_t *map) {
+    if (map->is_ordered) {
+        return map->alloc * sizeof(mp_map_elem_t);
+    }
+    return map_table_bytes(map->alloc);
+}
+#else
 // CIRCUITPY-CHANGE: Helper for allocating tables of elements
 #define malloc_table(num) m_new0(mp_map_elem_t, num)
+#define free_table(map) m_del(mp_map_elem_t, (map)->table, (map)->alloc)
+
+size_t mp_map_table_size(const mp_map_t *map) {
+    return map->alloc * sizeof(mp_map_elem_t);
+}
+#endif
 
 void mp_map_init(mp_map_t *map, size_t n) {
     if (n == 0) {
@@ -104,6 +234,17 @@ void mp_map_init(mp_map_t *map, size_t n) {
     map->is_ordered = 0;
 }
 
+// An ordered map's table is just the array of entries, which is smaller than a
+// hash table, so it must be ordered from the start.
+void mp_map_init_ordered(mp_map_t *map, size_t n) {
+    map->alloc = n;
+    map->table = n == 0 ? NULL : m_new0(mp_map_elem_t, n);
+    map->used = 0;
+    map->all_keys_are_qstrs = 1;
+    map->is_fixed = 0;
+    map->is_ordered = 1;
+}
+
 void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
     map->alloc = n;
     map->used = n;
@@ -116,14 +257,14 @@ void mp_map_init_fixed_table(mp_map_t *map, size_t n, const mp_obj_t *table) {
 // Differentiate from mp_map_clear() - semantics is different
 void mp_map_deinit(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        free_table(map);
     }
     map->used = map->alloc = 0;
 }
 
 void mp_map_clear(mp_map_t *map) {
     if (!map->is_fixed) {
-        m_del(mp_map_elem_t, map->table, map->alloc);
+        free_table(map);
     }
     map->alloc = 0;
     map->used = 0;
@@ -132,6 +273,68 @@ void mp_map_clear(mp_map_t *map) {
     map->table = NULL;
 }
 
+#if MICROPY_OPT_MAP_ROBIN_HOOD
+// Moves the entries to a new table, leaving out the holes, and fills in its
+// buckets without looking up the keys again. When enough entries have been
+// removed, or there's no memory for a bigger table (such as when the heap is
+// locked), the entries are moved down within the table they're in instead.
+static void mp_map_rehash(mp_map_t *map) {
+    size_t holes = map->alloc == 0 ? 0 : *map_filled(map) - map->used;
+    mp_map_elem_t *new_table = NULL;
+    size_t new_alloc = map->alloc;
+    if (holes == 0 || holes < map->alloc / 8) {
+        // Leave room to add more so that adding and removing in turn doesn't
+        // rehash every time.
+        new_alloc = get_hash_alloc_greater_or_equal_to(map->used + map->used / 4 + 1);
+        if (holes == 0) {
+            new_table = malloc_table(new_alloc);
+        } else {
+            new_table = m_malloc_maybe(map_table_bytes(new_alloc));
+            if (new_table != NULL) {
+                memset(new_table, 0, map_table_bytes(new_alloc));
+            } else {
+                new_alloc = map->alloc;
+            }
+        }
+    }
+    DEBUG_printf("mp_map_rehash(%p): " UINT_FMT " -> " UINT_FMT "\n", map, map->alloc, new_alloc);
+    // If we reach this point, table resizing succeeded, now we can edit the old map.
+    mp_map_t old_map = *map;
+    if (new_table == NULL) {
+        new_table = map->table;
+        memset(map_buckets(map), 0, ((size_t)1 << map_buckets_log2(new_alloc)) * map_bucket_bytes(new_alloc));
+    }
+    map->alloc = new_alloc;
+    map->table = new_table;
+    map->all_keys_are_qstrs = 1;
+    map_hash_t *hashes = map_hashes(map);
+    size_t log2 = map_buckets_log2(new_alloc);
+    size_t n = 0;
+    size_t old_filled = 0;
+    if (old_map.alloc != 0) {
+        const map_hash_t *old_hashes = map_hashes(&old_map);
+        old_filled = *map_filled(&old_map);
+        for (size_t i = 0; i < old_filled; i++) {
+            if (old_map.table[i].key != MP_OBJ_SENTINEL) {
+                new_table[n] = old_map.table[i];
+                hashes[n] = old_hashes[i];
+                if (!mp_obj_is_qstr(new_table[n].key)) {
+                    map->all_keys_are_qstrs = 0;
+                }
+                map_bucket_insert(map, map_home(hashes[n], log2), 0, n + 1);
+                n++;
+            }
+        }
+    }
+    *map_filled(map) = n;
+    if (new_table == old_map.table) {
+        // Clear the entries that were moved down.
+        memset(new_table + n, 0, (old_filled - n) * sizeof(mp_map_elem_t));
+    } else {
+        free_table(&old_map);
+    }
+}
+#else
 static void mp_map_rehash(mp_map_t *map) {
     size_t old_alloc = map->alloc;
     size_t new_alloc = get_hash_alloc_greater_or_equal_to(map->alloc + 1);
@@ -151,6 +354,7 @@ static void mp_map_rehash(mp_map_t *map) {
     }
     m_del(mp_map_elem_t, old_table, old_alloc);
 }
+#endif
 
 // MP_MAP_LOOKUP behaviour:
 //  - returns NULL if not found, else the slot it was found in with key,value non-null
@@ -254,6 +458,58 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
         hash = MP_OBJ_SMALL_INT_VALUE(mp_unary_op(MP_UNARY_OP_HASH, index));
     }
 
+    #if MICROPY_OPT_MAP_ROBIN_HOOD
+    for (;;) {
+        size_t log2 = map_buckets_log2(map->alloc);
+        size_t mask = ((size_t)1 << log2) - 1;
+        size_t bytes = map_bucket_bytes(map->alloc);
+        const uint8_t *buckets = map_buckets(map);
+        const map_hash_t *hashes = map_hashes(map);
+        size_t pos = map_home(hash, log2);
+        size_t dist = 0;
+        for (;; pos = (pos + 1) & mask, dist++) {
+            size_t entry = map_bucket_get(buckets, bytes, pos);
+            if (entry == 0 || ((pos - map_home(hashes[entry - 1], log2)) & mask) < dist) {
+                // index would be in this bucket if it was in the table
+                break;
+            }
+            mp_map_elem_t *slot = &map->table[entry - 1];
+            // Compare the hashes first so that keys that aren't qstrs are only
+            // compared when they're likely to be equal.
+            if (hashes[entry - 1] == (map_hash_t)hash
+                && (slot->key == index || (!compare_only_ptrs && mp_obj_equal(slot->key, index)))) {
+                // found index
+                // Note: CPython does not replace the index; try x={True:'true'};x[1]='one';x
+                if (lookup_kind == MP_MAP_LOOKUP_REMOVE_IF_FOUND) {
+                    // keep slot->value so that caller can access it if needed
+                    map->used--;
+                    slot->key = MP_OBJ_SENTINEL;
+                    map_bucket_remove(map, pos);
+                }
+                MAP_CACHE_SET(index, entry - 1);
+                return slot;
+            }
+        }
+        if (lookup_kind != MP_MAP_LOOKUP_ADD_IF_NOT_FOUND) {
+            return NULL;
+        }
+        size_t *filled = map_filled(map);
+        if (*filled < map->alloc) {
+            size_t n = (*filled)++;
+            map->used++;
+            map->table[n].key = index;
+            map->table[n].value = MP_OBJ_NULL;
+            map_hashes(map)[n] = hash;
+            if (!mp_obj_is_qstr(index)) {
+                map->all_keys_are_qstrs = 0;
+            }
+            map_bucket_insert(map, pos, dist, n + 1);
+            return &map->table[n];
+        }
+        // no room for another entry, rehash and search again
+        mp_map_rehash(map);
+    }
+    #else
     size_t pos = hash % map->alloc;
     size_t start_pos = pos;
     mp_map_elem_t *avail_slot = NULL;
@@ -324,6 +580,7 @@ mp_map_elem_t *MICROPY_WRAP_MP_MAP_LOOKUP(mp_map_lookup)(mp_map_t * map, mp_obj_
             }
         }
     }
+    #endif
 }
 
 /******************************************************************************/
@@ -187,6 +187,17 @@
 #define MICROPY_ALLOC_GC_STACK_SIZE (64)
 #endif
 
+// Number of threads that mark the heap in parallel, starting from different
+// roots. Values above 1 need the port to provide gc_parallel_mark_run().
+#ifndef MICROPY_GC_PARALLEL_MARK
+#define MICROPY_GC_PARALLEL_MARK (0)
+#endif
+
+// Number of roots collected before they are handed to the marking threads.
+#ifndef MICROPY_GC_PARALLEL_MARK_ROOTS
+#define MICROPY_GC_PARALLEL_MARK_ROOTS (1024)
+#endif
+
 // The C-type to use for entries in the GC stack.  By default it allows the
 // heap to be as large as the address space, but the bit-width of this type can
 // be reduced to save memory when the heap is small enough.  The type must be
@@ -601,6 +612,56 @@
 #define MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE (128)
 #endif
 
+// Whether the bytecode instructions that load attributes, methods and globals
+// remember where they found them, so they don't share the map lookup cache
+// with every other lookup. The entries are kept in a table attached to each
+// function object when it first loads one.
+#ifndef MICROPY_OPT_INLINE_CACHE
+#define MICROPY_OPT_INLINE_CACHE (0)
+#endif
+
+// Largest number of entries in the table of each function.
+#ifndef MICROPY_OPT_INLINE_CACHE_MAX_ENTRIES
+#define MICROPY_OPT_INLINE_CACHE_MAX_ENTRIES (32)
+#endif
+
+// Whether the VM rewrites arithmetic, comparison and subscript instructions in
+// bytecode held in RAM into forms specialised to the types of their operands
+// (small ints, floats, lists). Can't be used with sys.settrace.
+#ifndef MICROPY_OPT_QUICKEN
+#define MICROPY_OPT_QUICKEN (0)
+#endif
+
+// Whether dicts and other maps that aren't ordered keep their entries in the
+// order they were added, with the hash of each key and a separate table of
+// buckets probed with Robin Hood hashing. Lookups compare cached hashes before
+// keys, which helps most with keys that are strs or tuples. Uses 5 or 6
+// more bytes of RAM per entry.
+#ifndef MICROPY_OPT_MAP_ROBIN_HOOD
+#define MICROPY_OPT_MAP_ROBIN_HOOD (0)
+#endif
+
+// Whether qstrs interned at runtime are also kept in a hash table so that
+// looking up a string doesn't compare it with each of them. Uses 2 to 8 words
+// of RAM for each qstr interned at runtime.
+#ifndef MICROPY_OPT_QSTR_INDEX
+#define MICROPY_OPT_QSTR_INDEX (0)
+#endif
+
+// Whether big integers are multiplied with the Karatsuba and Toom-3 methods,
+// and divided and converted to strings by splitting them in two, once they are
+// large enough. Increases x86-64 code size by about 5.5k bytes.
+#ifndef MICROPY_OPT_MPZ_SUBQUADRATIC
+#define MICROPY_OPT_MPZ_SUBQUADRATIC (0)
+#endif
+
+// Whether pow(a, b, m) with an odd m uses Montgomery multiplication and a
+// sliding window over the bits of b, instead of a multiplication and a
+// division for each bit. Increases x86-64 code size by about 1.5k bytes.
+#ifndef MICROPY_OPT_MPZ_MONTGOMERY
+#define MICROPY_OPT_MPZ_MONTGOMERY (0)
+#endif
+
 // Whether to use fast versions of bitwise operations (and, or, xor) when the
 // arguments are both positive.  Increases Thumb2 code size by about 250 bytes.
 #ifndef MICROPY_OPT_MPZ_BITWISE
@@ -687,6 +748,34 @@
 #define MICROPY_GC_SPLIT_HEAP_AUTO (0)
 #endif
 
+// Number of runs of free blocks remembered per size class in each heap area,
+// so that multi-block allocations can usually skip scanning the allocation
+// table.  Set to 0 to always scan.
+#ifndef MICROPY_GC_FREE_RUN_SLOTS
+#define MICROPY_GC_FREE_RUN_SLOTS (MICROPY_CONFIG_ROM_LEVEL_AT_LEAST_EXTRA_FEATURES ? 4 : 0)
+#endif
+
+// Whether the sweep after a collection can be spread over several slices so
+// that collections don't pause for the whole sweep. The rest of the sweep is
+// done by gc_sweep_slice() or when an allocation needs the memory.
+#ifndef MICROPY_GC_INCREMENTAL_SWEEP
+#define MICROPY_GC_INCREMENTAL_SWEEP (0)
+#endif
+
+// Default number of blocks swept per slice when the sweep is incremental,
+// configurable by gc.sweep_budget(). 0 sweeps everything at once.
+#ifndef MICROPY_GC_SWEEP_BUDGET
+#define MICROPY_GC_SWEEP_BUDGET (4096)
+#endif
+
+// Number of blocks in the nursery, a run of free blocks that small objects
+// without a finaliser are allocated from by bumping an index. Objects that
+// die young then tend to free whole runs at the next collection. Set to 0 to
+// allocate every object by scanning the allocation table.
+#ifndef MICROPY_GC_NURSERY_BLOCKS
+#define MICROPY_GC_NURSERY_BLOCKS (0)
+#endif
+
 // Hook to run code during time consuming garbage collector operations
 // *i* is the loop index variable (e.g. can be used to run every x loops)
 #ifndef MICROPY_GC_HOOK_LOOP
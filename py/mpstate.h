@@ -100,6 +100,18 @@ typedef struct _mp_sched_item_t {
 #define GC_LOCK_DEPTH_SHIFT 0
 #endif
 
+#if MICROPY_GC_FREE_RUN_SLOTS
+// Size class c of the free run hints holds runs of at least 2 << c blocks.
+#define MP_GC_FREE_RUN_CLASSES (7)
+
+// A run of free blocks that was free when it was recorded. len is 0 for an
+// unused slot.
+typedef struct _mp_gc_free_run_t {
+    size_t start;
+    size_t len;
+} mp_gc_free_run_t;
+#endif
+
 // This structure holds information about a single contiguous area of
 // memory reserved for the memory manager.
 typedef struct _mp_state_mem_area_t {
@@ -121,6 +133,18 @@ typedef struct _mp_state_mem_area_t {
 
     size_t gc_last_free_atb_index;
     size_t gc_last_used_block; // The block ID of the highest block allocated in the area
+    // One bit for each 32nd of the area that has marked blocks whose children
+    // were dropped because the mark stack was full.
+    uint32_t gc_overflow_chunks;
+    #if MICROPY_GC_FREE_RUN_SLOTS
+    mp_gc_free_run_t gc_free_runs[MP_GC_FREE_RUN_CLASSES][MICROPY_GC_FREE_RUN_SLOTS];
+    #endif
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Next block to sweep or (size_t)-1 when the area isn't being swept.
+    // Blocks from here on still have the marks from the last collection.
+    size_t gc_sweep_block;
+    size_t gc_sweep_last_used_block;
+    #endif
 } mp_state_mem_area_t;
 
 // This structure hold information about the memory allocation system.
@@ -139,6 +163,14 @@ typedef struct _mp_state_mem_t {
     // Array that tracks the area for each block on gc_block_stack.
     mp_state_mem_area_t *gc_area_stack[MICROPY_ALLOC_GC_STACK_SIZE];
     #endif
+    #if MICROPY_GC_PARALLEL_MARK > 1
+    // Roots waiting for the marking threads.
+    MICROPY_GC_STACK_ENTRY_TYPE gc_mark_root_blocks[MICROPY_GC_PARALLEL_MARK_ROOTS];
+    #if MICROPY_GC_SPLIT_HEAP
+    mp_state_mem_area_t *gc_mark_root_areas[MICROPY_GC_PARALLEL_MARK_ROOTS];
+    #endif
+    size_t gc_mark_root_count;
+    #endif
 
     // This variable controls auto garbage collection.  If set to 0 then the
     // GC won't automatically run when gc_alloc can't find enough blocks.  But
@@ -158,6 +190,21 @@ typedef struct _mp_state_mem_t {
     size_t gc_collected;
     #endif
 
+    #if MICROPY_GC_NURSERY_BLOCKS
+    // Blocks from gc_nursery_block up to gc_nursery_end in gc_nursery_area
+    // were free when the nursery was filled. The area is NULL when no run was
+    // found, until the next collection.
+    mp_state_mem_area_t *gc_nursery_area;
+    size_t gc_nursery_block;
+    size_t gc_nursery_end;
+    #endif
+
+    #if MICROPY_GC_INCREMENTAL_SWEEP
+    // Area the sweep continues from, NULL when no sweep is pending.
+    mp_state_mem_area_t *gc_sweep_area;
+    size_t gc_sweep_budget;
+    #endif
+
     #if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL
     // This is a global mutex used to make the GC thread-safe.
     mp_thread_recursive_mutex_t gc_mutex;
@@ -282,6 +329,11 @@ typedef struct _mp_state_vm_t {
     // See mp_map_lookup.
     uint8_t map_lookup_cache[MICROPY_OPT_MAP_LOOKUP_CACHE_SIZE];
     #endif
+
+    #if MICROPY_OPT_INLINE_CACHE
+    // Changed whenever a class is changed. See py/inlinecache.c.
+    size_t inline_cache_version;
+    #endif
 } mp_state_vm_t;
 
 // This structure holds state that is specific to a given thread. Everything
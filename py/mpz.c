@@ -36,6 +36,22 @@
 #define DIG_MSB  (MPZ_LONG_1 << (DIG_SIZE - 1))
 #define DIG_BASE (MPZ_LONG_1 << DIG_SIZE)
 
+#if MICROPY_OPT_MPZ_SUBQUADRATIC
+// Below these sizes, in digits, the schoolbook algorithms are faster.
+#ifndef MPZ_MUL_KARATSUBA_THRESHOLD
+#define MPZ_MUL_KARATSUBA_THRESHOLD (32)
+#endif
+#ifndef MPZ_MUL_TOOM3_THRESHOLD
+#define MPZ_MUL_TOOM3_THRESHOLD (160)
+#endif
+#ifndef MPZ_DIV_DC_THRESHOLD
+#define MPZ_DIV_DC_THRESHOLD (48)
+#endif
+#ifndef MPZ_STR_DC_THRESHOLD
+#define MPZ_STR_DC_THRESHOLD (48)
+#endif
+#endif
+
 /*
  mpz is an arbitrary precision integer type with a public API.
 
@@ -461,6 +477,127 @@ static size_t mpn_mul(mpz_dig_t *idig, mpz_dig_t *jdig, size_t jlen, mpz_dig_t *
     return ilen;
 }
 
+#if MICROPY_OPT_MPZ_SUBQUADRATIC
+/* computes i = i + j
+   assumes ilen >= jlen and that the result fits in ilen digits
+   j need not be normalised
+*/
+static void mpn_add_into(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_t carry = 0;
+
+    ilen -= jlen;
+
+    for (; jlen > 0; --jlen, ++idig, ++jdig) {
+        carry += (mpz_dbl_dig_t)*idig + (mpz_dbl_dig_t)*jdig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+
+    for (; carry != 0 && ilen > 0; --ilen, ++idig) {
+        carry += *idig;
+        *idig = carry & DIG_MASK;
+        carry >>= DIG_SIZE;
+    }
+}
+
+/* computes i = i - j
+   assumes ilen >= jlen and i >= j
+   j need not be normalised
+*/
+static void mpn_sub_from(mpz_dig_t *idig, size_t ilen, const mpz_dig_t *jdig, size_t jlen) {
+    mpz_dbl_dig_signed_t borrow = 0;
+
+    ilen -= jlen;
+
+    for (; jlen > 0; --jlen, ++idig, ++jdig) {
+        borrow += (mpz_dbl_dig_t)*idig - (mpz_dbl_dig_t)*jdig;
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+
+    for (; borrow != 0 && ilen > 0; --ilen, ++idig) {
+        borrow += *idig;
+        *idig = borrow & DIG_MASK;
+        borrow >>= DIG_SIZE;
+    }
+}
+
+/* returns the number of digits of scratch memory needed by mpn_mul_karatsuba
+   when the longer operand has len digits
+*/
+static size_t mpn_mul_karatsuba_scratch(size_t len) {
+    size_t scratch = 0;
+    while (len >= MPZ_MUL_KARATSUBA_THRESHOLD) {
+        size_t half = (len + 1) / 2;
+        scratch += 4 * half + 4;
+        len = half + 1;
+    }
+    return scratch;
+}
+
+/* computes i = j * k using Karatsuba's method, writing all jlen + klen digits of i
+   assumes i is zeroed; assumes scratch has mpn_mul_karatsuba_scratch(max(jlen, klen)) digits
+   j, k need not be normalised but must not be empty; i must not overlap j, k
+*/
+static void mpn_mul_karatsuba(mpz_dig_t *idig, const mpz_dig_t *jdig, size_t jlen, const mpz_dig_t *kdig, size_t klen, mpz_dig_t *scratch) {
+    if (jlen < klen) {
+        const mpz_dig_t *tdig = jdig;
+        jdig = kdig;
+        kdig = tdig;
+        size_t tlen = jlen;
+        jlen = klen;
+        klen = tlen;
+    }
+
+    if (klen < MPZ_MUL_KARATSUBA_THRESHOLD) {
+        mpn_mul(idig, (mpz_dig_t *)jdig, jlen, (mpz_dig_t *)kdig, klen);
+        return;
+    }
+
+    size_t half = (jlen + 1) / 2;
+
+    if (klen <= half) {
+        // k is much shorter than j, so multiply k by pieces of j that are as long as it
+        mpz_dig_t *prod = scratch;
+        for (size_t off = 0; off < jlen; off += klen) {
+            size_t len = MIN(klen, jlen - off);
+            memset(prod, 0, (len + klen) * sizeof(mpz_dig_t));
+            mpn_mul_karatsuba(prod, jdig + off, len, kdig, klen, scratch + len + klen);
+            mpn_add_into(idig + off, jlen + klen - off, prod, len + klen);
+        }
+        return;
+    }
+
+    // j = j1 * B^half + j0 and k = k1 * B^half + k0, with j1 and k1 both non-empty
+    size_t j1len = jlen - half;
+    size_t k1len = klen - half;
+    mpz_dig_t *jsum = scratch;
+    mpz_dig_t *ksum = jsum + half + 1;
+    mpz_dig_t *mid = ksum + half + 1;
+    scratch = mid + 2 * half + 2;
+
+    // i = j1 * k1 * B^(2 * half) + j0 * k0
+    mpn_mul_karatsuba(idig, jdig, half, kdig, half, scratch);
+    mpn_mul_karatsuba(idig + 2 * half, jdig + half, j1len, kdig + half, k1len, scratch);
+
+    // mid = (j0 + j1) * (k0 + k1) - j0 * k0 - j1 * k1 = j0 * k1 + j1 * k0
+    memcpy(jsum, jdig, half * sizeof(mpz_dig_t));
+    jsum[half] = 0;
+    mpn_add_into(jsum, half + 1, jdig + half, j1len);
+    memcpy(ksum, kdig, half * sizeof(mpz_dig_t));
+    ksum[half] = 0;
+    mpn_add_into(ksum, half + 1, kdig + half, k1len);
+    memset(mid, 0, (2 * half + 2) * sizeof(mpz_dig_t));
+    mpn_mul_karatsuba(mid, jsum, half + 1, ksum, half + 1, scratch);
+    mpn_sub_from(mid, 2 * half + 2, idig, 2 * half);
+    mpn_sub_from(mid, 2 * half + 2, idig + 2 * half, j1len + k1len);
+
+    // i += mid * B^half; the top digits of mid are zero if they don't fit
+    size_t ilen = jlen + klen - half;
+    mpn_add_into(idig + half, ilen, mid, MIN(ilen, 2 * half + 2));
+}
+#endif
+
 /* natural_div - quo * den + new_num = old_num (ie num is replaced with rem)
    assumes den != 0
    assumes num_dig has enough memory to be extended by 1 digit
@@ -606,6 +743,74 @@ static void mpn_div(mpz_dig_t *num_dig, size_t *num_len, const mpz_dig_t *den_di
     }
 }
 
+#if MICROPY_OPT_MPZ_MONTGOMERY
+/* returns -m0^-1 mod 2^DIG_SIZE
+   assumes m0 is odd
+*/
+static mpz_dig_t mpn_mont_inverse(mpz_dig_t m0) {
+    // m0 is its own inverse to 3 bits, and each step doubles the number of correct bits
+    mpz_dbl_dig_t inv = m0;
+    for (size_t bits = 3; bits < DIG_SIZE; bits *= 2) {
+        inv = (inv * (2 - ((m0 * inv) & DIG_MASK))) & DIG_MASK;
+    }
+    return (DIG_BASE - inv) & DIG_MASK;
+}
+
+/* computes i = j * k / 2^(n * DIG_SIZE) mod m, by Montgomery multiplication
+   assumes j, k < m and all have n digits, padded with zeros; assumes minv = -m^-1 mod 2^DIG_SIZE
+   assumes t has n + 2 digits of scratch memory
+   can have i, j, k pointing to same memory
+*/
+static void mpn_mont_mul(mpz_dig_t *idig, const mpz_dig_t *jdig, const mpz_dig_t *kdig, const mpz_dig_t *mdig, size_t n, mpz_dig_t minv, mpz_dig_t *t) {
+    memset(t, 0, (n + 2) * sizeof(mpz_dig_t));
+
+    for (size_t i = 0; i < n; ++i) {
+        // t += j * k[i]
+        mpz_dbl_dig_t carry = 0;
+        for (size_t j = 0; j < n; ++j) {
+            carry += (mpz_dbl_dig_t)t[j] + (mpz_dbl_dig_t)jdig[j] * kdig[i];
+            t[j] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        carry += t[n];
+        t[n] = carry & DIG_MASK;
+        t[n + 1] = carry >> DIG_SIZE;
+
+        // t = (t + u * m) / 2^DIG_SIZE, with u chosen so the lowest digit is zero
+        mpz_dig_t u = (t[0] * (mpz_dbl_dig_t)minv) & DIG_MASK;
+        carry = ((mpz_dbl_dig_t)t[0] + (mpz_dbl_dig_t)u * mdig[0]) >> DIG_SIZE;
+        for (size_t j = 1; j < n; ++j) {
+            carry += (mpz_dbl_dig_t)t[j] + (mpz_dbl_dig_t)u * mdig[j];
+            t[j - 1] = carry & DIG_MASK;
+            carry >>= DIG_SIZE;
+        }
+        carry += t[n];
+        t[n - 1] = carry & DIG_MASK;
+        t[n] = t[n + 1] + (carry >> DIG_SIZE);
+    }
+
+    // t < 2m, so subtract m at most once
+    bool ge = t[n] != 0;
+    if (!ge) {
+        size_t j = n;
+        while (j > 0 && t[j - 1] == mdig[j - 1]) {
+            --j;
+        }
+        ge = j == 0 || t[j - 1] > mdig[j - 1];
+    }
+    if (ge) {
+        mpz_dbl_dig_signed_t borrow = 0;
+        for (size_t j = 0; j < n; ++j) {
+            borrow += (mpz_dbl_dig_t)t[j] - (mpz_dbl_dig_t)mdig[j];
+            t[j] = borrow & DIG_MASK;
+            borrow >>= DIG_SIZE;
+        }
+    }
+
+    memcpy(idig, t, n * sizeof(mpz_dig_t));
+}
+#endif
+
 #define MIN_ALLOC (2)
 
 void mpz_init_zero(mpz_t *z) {
@@ -1102,14 +1307,12 @@ void mpz_shr_inpl(mpz_t *dest, const mpz_t *lhs, mp_uint_t rhs) {
     if (lhs->len == 0 || rhs == 0) {
         mpz_set(dest, lhs);
     } else {
-        mpz_need_dig(dest, lhs->len);
-        dest->len = mpn_shr(dest->dig, lhs->dig, lhs->len, rhs);
-        dest->neg = lhs->neg;
-        if (dest->neg) {
-            // arithmetic shift right, rounding to negative infinity
+        // arithmetic shift right, rounding to negative infinity; the bits
+        // shifted out are checked first as dest may be the same as lhs
+        mpz_dig_t round_up = 0;
+        if (lhs->neg) {
             mp_uint_t n_whole = rhs / DIG_SIZE;
             mp_uint_t n_part = rhs % DIG_SIZE;
-            mpz_dig_t round_up = 0;
             for (size_t i = 0; i < lhs->len && i < n_whole; i++) {
                 if (lhs->dig[i] != 0) {
                     round_up = 1;
@@ -1119,15 +1322,18 @@ void mpz_shr_inpl(mpz_t *dest, const mpz_t *lhs, mp_uint_t rhs) {
             if (n_whole < lhs->len && (lhs->dig[n_whole] & ((1 << n_part) - 1)) != 0) {
                 round_up = 1;
             }
-            if (round_up) {
-                if (dest->len == 0) {
-                    // dest == 0, so need to add 1 by hand (answer will be -1)
-                    dest->dig[0] = 1;
-                    dest->len = 1;
-                } else {
-                    // dest > 0, so can use mpn_add to add 1
-                    dest->len = mpn_add(dest->dig, dest->dig, dest->len, &round_up, 1);
-                }
+        }
+        mpz_need_dig(dest, lhs->len);
+        dest->len = mpn_shr(dest->dig, lhs->dig, lhs->len, rhs);
+        dest->neg = lhs->neg;
+        if (round_up) {
+            if (dest->len == 0) {
+                // dest == 0, so need to add 1 by hand (answer will be -1)
+                dest->dig[0] = 1;
+                dest->len = 1;
+            } else {
+                // dest > 0, so can use mpn_add to add 1
+                dest->len = mpn_add(dest->dig, dest->dig, dest->len, &round_up, 1);
             }
         }
     }
@@ -1290,6 +1496,104 @@ void mpz_xor_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     #endif
 }
 
+#if MICROPY_OPT_MPZ_SUBQUADRATIC
+/* makes z a read-only view of len digits of src, starting at digit off
+   z has neg=0 and must not be passed to mpz_deinit
+*/
+static void mpz_init_view(mpz_t *z, const mpz_t *src, size_t off, size_t len) {
+    z->neg = 0;
+    z->fixed_dig = 1;
+    if (off >= src->len) {
+        off = 0;
+        len = 0;
+    } else if (len > src->len - off) {
+        len = src->len - off;
+    }
+    z->dig = src->dig + off;
+    z->len = mpn_remove_trailing_zeros(z->dig, z->dig + len);
+    z->alloc = z->len;
+}
+
+/* computes dest = |lhs| * |rhs| using Toom-Cook 3-way multiplication
+   can't have dest the same as lhs or rhs
+*/
+static void mpz_mul_toom3(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
+    // split each operand into three pieces of k digits: lhs = a2 X^2 + a1 X + a0, X = B^k
+    size_t k = (MAX(lhs->len, rhs->len) + 2) / 3;
+    mpz_t a[3], b[3];
+    for (size_t i = 0; i < 3; ++i) {
+        mpz_init_view(&a[i], lhs, i * k, k);
+        mpz_init_view(&b[i], rhs, i * k, k);
+    }
+
+    mpz_t r0, r1, rm1, rm2, rinf, r2, r3, pa, pb;
+    mpz_init_zero(&r0);
+    mpz_init_zero(&r1);
+    mpz_init_zero(&rm1);
+    mpz_init_zero(&rm2);
+    mpz_init_zero(&rinf);
+    mpz_init_zero(&r2);
+    mpz_init_zero(&r3);
+    mpz_init_zero(&pa);
+    mpz_init_zero(&pb);
+
+    // evaluate both polynomials at 0, 1, -1, -2 and infinity, and multiply them pointwise
+    mpz_mul_inpl(&r0, &a[0], &b[0]);
+    mpz_mul_inpl(&rinf, &a[2], &b[2]);
+    mpz_add_inpl(&pa, &a[0], &a[2]);
+    mpz_add_inpl(&pb, &b[0], &b[2]);
+    mpz_add_inpl(&r2, &pa, &a[1]);
+    mpz_add_inpl(&r3, &pb, &b[1]);
+    mpz_mul_inpl(&r1, &r2, &r3);
+    mpz_sub_inpl(&pa, &pa, &a[1]);
+    mpz_sub_inpl(&pb, &pb, &b[1]);
+    mpz_mul_inpl(&rm1, &pa, &pb);
+    // p(-2) = 2 * (p(-1) + p2) - p0
+    mpz_add_inpl(&pa, &pa, &a[2]);
+    mpz_shl_inpl(&pa, &pa, 1);
+    mpz_sub_inpl(&pa, &pa, &a[0]);
+    mpz_add_inpl(&pb, &pb, &b[2]);
+    mpz_shl_inpl(&pb, &pb, 1);
+    mpz_sub_inpl(&pb, &pb, &b[0]);
+    mpz_mul_inpl(&rm2, &pa, &pb);
+
+    // interpolate the coefficients of the product with Bodrato's sequence; all divisions are exact
+    mpz_t three;
+    mpz_init_from_int(&three, 3);
+    mpz_sub_inpl(&r3, &rm2, &r1);
+    mpz_divmod_inpl(&pa, &pb, &r3, &three);
+    mpz_sub_inpl(&r1, &r1, &rm1);
+    mpz_shr_inpl(&r1, &r1, 1);
+    mpz_sub_inpl(&r2, &rm1, &r0);
+    mpz_sub_inpl(&r3, &r2, &pa);
+    mpz_shr_inpl(&r3, &r3, 1);
+    mpz_add_inpl(&r3, &r3, &rinf);
+    mpz_add_inpl(&r3, &r3, &rinf);
+    mpz_add_inpl(&r2, &r2, &r1);
+    mpz_sub_inpl(&r2, &r2, &rinf);
+    mpz_sub_inpl(&r1, &r1, &r3);
+
+    // recombine: dest = (((rinf X + r3) X + r2) X + r1) X + r0
+    mpz_t *coef[4] = {&r3, &r2, &r1, &r0};
+    mpz_set(dest, &rinf);
+    for (size_t i = 0; i < 4; ++i) {
+        mpz_shl_inpl(dest, dest, k * DIG_SIZE);
+        mpz_add_inpl(dest, dest, coef[i]);
+    }
+
+    mpz_deinit(&three);
+    mpz_deinit(&r0);
+    mpz_deinit(&r1);
+    mpz_deinit(&rm1);
+    mpz_deinit(&rm2);
+    mpz_deinit(&rinf);
+    mpz_deinit(&r2);
+    mpz_deinit(&r3);
+    mpz_deinit(&pa);
+    mpz_deinit(&pb);
+}
+#endif
+
 /* computes dest = lhs * rhs
    can have dest, lhs, rhs the same
 */
@@ -1309,9 +1613,26 @@ void mpz_mul_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
         rhs = temp = mpz_clone(rhs);
     }
 
-    mpz_need_dig(dest, lhs->len + rhs->len); // min mem l+r-1, max mem l+r
-    memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
-    dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    #if MICROPY_OPT_MPZ_SUBQUADRATIC
+    size_t min_len = MIN(lhs->len, rhs->len);
+    size_t max_len = MAX(lhs->len, rhs->len);
+    if (min_len >= MPZ_MUL_TOOM3_THRESHOLD && 3 * min_len > 2 * max_len) {
+        mpz_mul_toom3(dest, lhs, rhs);
+    } else if (min_len >= MPZ_MUL_KARATSUBA_THRESHOLD) {
+        size_t scratch_len = mpn_mul_karatsuba_scratch(max_len);
+        mpz_dig_t *scratch = m_new(mpz_dig_t, scratch_len);
+        mpz_need_dig(dest, lhs->len + rhs->len);
+        memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
+        mpn_mul_karatsuba(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len, scratch);
+        dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + lhs->len + rhs->len);
+        m_del(mpz_dig_t, scratch, scratch_len);
+    } else
+    #endif
+    {
+        mpz_need_dig(dest, lhs->len + rhs->len); // min mem l+r-1, max mem l+r
+        memset(dest->dig, 0, dest->alloc * sizeof(mpz_dig_t));
+        dest->len = mpn_mul(dest->dig, lhs->dig, lhs->len, rhs->dig, rhs->len);
+    }
 
     if (lhs->neg == rhs->neg) {
         dest->neg = 0;
@@ -1356,6 +1677,94 @@ void mpz_pow_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs) {
     mpz_free(n);
 }
 
+#if MICROPY_OPT_MPZ_MONTGOMERY
+/* computes dest = (lhs ** rhs) % mod with Montgomery multiplication and a sliding window
+   assumes rhs > 0 and mod is odd and > 1
+   can have dest, lhs, rhs the same; mod can't be the same as dest
+*/
+static void mpz_pow3_montgomery(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t *mod) {
+    size_t n = mod->len;
+    mpz_dig_t minv = mpn_mont_inverse(mod->dig[0]);
+
+    // choose the window size from the number of bits in the exponent
+    size_t n_bits = (rhs->len - 1) * DIG_SIZE;
+    for (mpz_dig_t d = rhs->dig[rhs->len - 1]; d != 0; d >>= 1) {
+        ++n_bits;
+    }
+    size_t window = n_bits <= 24 ? 2 : n_bits <= 80 ? 3 : n_bits <= 240 ? 4 : n_bits <= 672 ? 5 : 6;
+    size_t n_odd = 1 << (window - 1);
+
+    // odd powers x, x^3, ... x^(2^window - 1), then x^2, the result and scratch
+    size_t alloc = (n_odd + 2) * n + n + 2;
+    mpz_dig_t *odd = m_new(mpz_dig_t, alloc);
+    mpz_dig_t *x2 = odd + n_odd * n;
+    mpz_dig_t *acc = x2 + n;
+    mpz_dig_t *t = acc + n;
+
+    // odd[0] = x = lhs * R mod m, where R = 2^(n * DIG_SIZE)
+    mpz_t x, quo;
+    mpz_init_zero(&x);
+    mpz_init_zero(&quo);
+    mpz_shl_inpl(&x, lhs, n * DIG_SIZE);
+    mpz_divmod_inpl(&quo, &x, &x, mod);
+    memset(odd, 0, n * sizeof(mpz_dig_t));
+    memcpy(odd, x.dig, x.len * sizeof(mpz_dig_t));
+    mpz_deinit(&x);
+    mpz_deinit(&quo);
+
+    mpn_mont_mul(x2, odd, odd, mod->dig, n, minv, t);
+    for (size_t i = 1; i < n_odd; ++i) {
+        mpn_mont_mul(odd + i * n, odd + (i - 1) * n, x2, mod->dig, n, minv, t);
+    }
+
+    // scan the exponent from the top, squaring for each bit and multiplying
+    // by an odd power for each window that starts and ends with a 1 bit
+    bool started = false;
+    for (size_t i = n_bits; i > 0;) {
+        --i;
+        if (((rhs->dig[i / DIG_SIZE] >> (i % DIG_SIZE)) & 1) == 0) {
+            mpn_mont_mul(acc, acc, acc, mod->dig, n, minv, t);
+            continue;
+        }
+        size_t low = i + 1 > window ? i + 1 - window : 0;
+        while (((rhs->dig[low / DIG_SIZE] >> (low % DIG_SIZE)) & 1) == 0) {
+            ++low;
+        }
+        size_t val = 0;
+        for (size_t j = i + 1; j > low;) {
+            --j;
+            val = (val << 1) | ((rhs->dig[j / DIG_SIZE] >> (j % DIG_SIZE)) & 1);
+        }
+        if (started) {
+            for (size_t j = low; j <= i; ++j) {
+                mpn_mont_mul(acc, acc, acc, mod->dig, n, minv, t);
+            }
+            mpn_mont_mul(acc, acc, odd + (val >> 1) * n, mod->dig, n, minv, t);
+        } else {
+            memcpy(acc, odd + (val >> 1) * n, n * sizeof(mpz_dig_t));
+            started = true;
+        }
+        i = low;
+        // CIRCUITPY-CHANGE: prevent usb and other background task starvation
+        #ifdef RUN_BACKGROUND_TASKS
+        RUN_BACKGROUND_TASKS;
+        #endif
+    }
+
+    // convert back from Montgomery form by multiplying by 1
+    memset(x2, 0, n * sizeof(mpz_dig_t));
+    x2[0] = 1;
+    mpn_mont_mul(acc, acc, x2, mod->dig, n, minv, t);
+
+    mpz_need_dig(dest, n);
+    memcpy(dest->dig, acc, n * sizeof(mpz_dig_t));
+    dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + n);
+    dest->neg = 0;
+
+    m_del(mpz_dig_t, odd, alloc);
+}
+#endif
+
 /* computes dest = (lhs ** rhs) % mod
    can have dest, lhs, rhs the same; mod can't be the same as dest
 */
@@ -1365,6 +1774,13 @@ void mpz_pow3_inpl(mpz_t *dest, const mpz_t *lhs, const mpz_t *rhs, const mpz_t
         return;
     }
 
+    #if MICROPY_OPT_MPZ_MONTGOMERY
+    if (rhs->len != 0 && !mod->neg && (mod->dig[0] & 1) != 0) {
+        mpz_pow3_montgomery(dest, lhs, rhs, mod);
+        return;
+    }
+    #endif
+
     mpz_set_from_int(dest, 1);
 
     if (rhs->len == 0) {
@@ -1478,15 +1894,11 @@ mpz_t *mpz_lcm(const mpz_t *z1, const mpz_t *z2) {
 }
 #endif
 
-/* computes new integers in quo and rem such that:
-       quo * rhs + rem = lhs
-       0 <= rem < rhs
-   can have lhs, rhs the same
-   assumes rhs != 0 (undefined behaviour if it is)
+/* computes quo = |lhs| // |rhs| and rem = lhs - quo * rhs by long division
+   rem has the sign of lhs
+   can have lhs, rhs the same; can have rem, lhs the same
 */
-void mpz_divmod_inpl(mpz_t *dest_quo, mpz_t *dest_rem, const mpz_t *lhs, const mpz_t *rhs) {
-    assert(!mpz_is_zero(rhs));
-
+static void mpz_divmod_schoolbook(mpz_t *dest_quo, mpz_t *dest_rem, const mpz_t *lhs, const mpz_t *rhs) {
     mpz_need_dig(dest_quo, lhs->len + 1); // +1 necessary?
     memset(dest_quo->dig, 0, (lhs->len + 1) * sizeof(mpz_dig_t));
     dest_quo->neg = 0;
@@ -1495,9 +1907,196 @@ void mpz_divmod_inpl(mpz_t *dest_quo, mpz_t *dest_rem, const mpz_t *lhs, const m
     mpz_set(dest_rem, lhs);
     mpn_div(dest_rem->dig, &dest_rem->len, rhs->dig, rhs->len, dest_quo->dig, &dest_quo->len);
     dest_rem->neg &= !!dest_rem->len;
+}
+
+#if MICROPY_OPT_MPZ_SUBQUADRATIC
+/* returns the number of significant bits in z
+*/
+static size_t mpz_bit_len(const mpz_t *z) {
+    if (z->len == 0) {
+        return 0;
+    }
+    size_t n = (z->len - 1) * DIG_SIZE;
+    for (mpz_dig_t d = z->dig[z->len - 1]; d != 0; d >>= 1) {
+        ++n;
+    }
+    return n;
+}
+
+/* computes dest = z & (2**n - 1)
+   can have dest, z the same; assumes z >= 0
+*/
+static void mpz_low_bits_inpl(mpz_t *dest, const mpz_t *z, size_t n) {
+    size_t len = MIN(z->len, (n + DIG_SIZE - 1) / DIG_SIZE);
+    mpz_need_dig(dest, len);
+    memmove(dest->dig, z->dig, len * sizeof(mpz_dig_t));
+    if (len * DIG_SIZE > n) {
+        dest->dig[len - 1] &= ((mpz_dig_t)1 << (n % DIG_SIZE)) - 1;
+    }
+    dest->len = mpn_remove_trailing_zeros(dest->dig, dest->dig + len);
+    dest->neg = 0;
+}
+
+static void mpz_div2n1n(mpz_t *quo, mpz_t *rem, const mpz_t *a, const mpz_t *b, size_t n);
+
+/* computes quo, rem of (a12 * 2**n + a3) / b, where b = b1 * 2**n + b2 has 2n bits
+   assumes a3 < 2**n and a12 < b * 2**n
+*/
+static void mpz_div3n2n(mpz_t *quo, mpz_t *rem, const mpz_t *a12, const mpz_t *a3, const mpz_t *b,
+    const mpz_t *b1, const mpz_t *b2, size_t n) {
+    mpz_t t;
+    mpz_init_zero(&t);
+    mpz_dig_t one_dig[MPZ_NUM_DIG_FOR_INT];
+    mpz_t one;
+    mpz_init_fixed_from_int(&one, one_dig, MPZ_NUM_DIG_FOR_INT, 1);
+
+    // estimate the quotient from the top digits, it is at most 2 too big
+    mpz_shr_inpl(&t, a12, n);
+    if (mpz_cmp(&t, b1) == 0) {
+        // quo = 2**n - 1, rem = a12 - b1 * 2**n + b1
+        mpz_shl_inpl(quo, &one, n);
+        mpz_sub_inpl(quo, quo, &one);
+        mpz_shl_inpl(&t, b1, n);
+        mpz_sub_inpl(rem, a12, &t);
+        mpz_add_inpl(rem, rem, b1);
+    } else {
+        mpz_div2n1n(quo, rem, a12, b1, n);
+    }
+
+    // rem = rem * 2**n + a3 - quo * b2, correcting quo until rem >= 0
+    mpz_shl_inpl(rem, rem, n);
+    mpz_add_inpl(rem, rem, a3);
+    mpz_mul_inpl(&t, quo, b2);
+    mpz_sub_inpl(rem, rem, &t);
+    while (rem->neg) {
+        mpz_sub_inpl(quo, quo, &one);
+        mpz_add_inpl(rem, rem, b);
+    }
+
+    mpz_deinit(&t);
+}
+
+/* computes quo, rem of a / b by Burnikel and Ziegler's recursive division
+   assumes b has n bits and a < b * 2**n
+   can't have quo, rem the same as a, b
+*/
+static void mpz_div2n1n(mpz_t *quo, mpz_t *rem, const mpz_t *a, const mpz_t *b, size_t n) {
+    if (mpz_bit_len(a) <= n + MPZ_DIV_DC_THRESHOLD * DIG_SIZE) {
+        mpz_divmod_schoolbook(quo, rem, a, b);
+        return;
+    }
+
+    // make n even, so b splits into two halves
+    mpz_t a_pad, b_pad;
+    mpz_init_zero(&a_pad);
+    mpz_init_zero(&b_pad);
+    bool pad = n & 1;
+    if (pad) {
+        mpz_shl_inpl(&a_pad, a, 1);
+        mpz_shl_inpl(&b_pad, b, 1);
+        a = &a_pad;
+        b = &b_pad;
+        ++n;
+    }
+    size_t half = n / 2;
+
+    mpz_t b1, b2, a12, a3, q1, r1;
+    mpz_init_zero(&b1);
+    mpz_init_zero(&b2);
+    mpz_init_zero(&a12);
+    mpz_init_zero(&a3);
+    mpz_init_zero(&q1);
+    mpz_init_zero(&r1);
+    mpz_shr_inpl(&b1, b, half);
+    mpz_low_bits_inpl(&b2, b, half);
+
+    // divide the top three quarters of a, then the remainder with the last quarter
+    mpz_shr_inpl(&a12, a, n);
+    mpz_shr_inpl(&a3, a, half);
+    mpz_low_bits_inpl(&a3, &a3, half);
+    mpz_div3n2n(&q1, &r1, &a12, &a3, b, &b1, &b2, half);
+    mpz_low_bits_inpl(&a3, a, half);
+    mpz_div3n2n(quo, rem, &r1, &a3, b, &b1, &b2, half);
+
+    mpz_shl_inpl(&q1, &q1, half);
+    mpz_add_inpl(quo, quo, &q1);
+    if (pad) {
+        mpz_shr_inpl(rem, rem, 1);
+    }
+
+    mpz_deinit(&a_pad);
+    mpz_deinit(&b_pad);
+    mpz_deinit(&b1);
+    mpz_deinit(&b2);
+    mpz_deinit(&a12);
+    mpz_deinit(&a3);
+    mpz_deinit(&q1);
+    mpz_deinit(&r1);
+}
+
+/* computes quo = |lhs| // |rhs| and rem = |lhs| % |rhs| with recursive division,
+   taking lhs in pieces the size of rhs
+   can have lhs, rhs the same; can have rem, lhs the same
+*/
+static void mpz_divmod_dc(mpz_t *dest_quo, mpz_t *dest_rem, const mpz_t *lhs, const mpz_t *rhs) {
+    mpz_t a, b;
+    mpz_init_view(&a, lhs, 0, lhs->len);
+    mpz_init_view(&b, rhs, 0, rhs->len);
+    size_t n = mpz_bit_len(&b);
+
+    mpz_t quo, rem, piece, q, r;
+    mpz_init_zero(&quo);
+    mpz_init_zero(&rem);
+    mpz_init_zero(&piece);
+    mpz_init_zero(&q);
+    mpz_init_zero(&r);
+
+    for (size_t i = (mpz_bit_len(&a) + n - 1) / n; i-- > 0;) {
+        mpz_shr_inpl(&piece, &a, i * n);
+        mpz_low_bits_inpl(&piece, &piece, n);
+        mpz_shl_inpl(&rem, &rem, n);
+        mpz_add_inpl(&rem, &rem, &piece);
+        mpz_div2n1n(&q, &r, &rem, &b, n);
+        mpz_set(&rem, &r);
+        mpz_shl_inpl(&quo, &quo, n);
+        mpz_add_inpl(&quo, &quo, &q);
+    }
+
+    mpz_set(dest_quo, &quo);
+    mpz_set(dest_rem, &rem);
+
+    mpz_deinit(&quo);
+    mpz_deinit(&rem);
+    mpz_deinit(&piece);
+    mpz_deinit(&q);
+    mpz_deinit(&r);
+}
+#endif
+
+/* computes new integers in quo and rem such that:
+       quo * rhs + rem = lhs
+       0 <= rem < rhs
+   can have lhs, rhs the same
+   assumes rhs != 0 (undefined behaviour if it is)
+*/
+void mpz_divmod_inpl(mpz_t *dest_quo, mpz_t *dest_rem, const mpz_t *lhs, const mpz_t *rhs) {
+    assert(!mpz_is_zero(rhs));
+
+    // dest_rem may be the same as lhs
+    bool lhs_neg = lhs->neg;
+
+    #if MICROPY_OPT_MPZ_SUBQUADRATIC
+    if (rhs->len >= MPZ_DIV_DC_THRESHOLD && lhs->len >= rhs->len + MPZ_DIV_DC_THRESHOLD) {
+        mpz_divmod_dc(dest_quo, dest_rem, lhs, rhs);
+        dest_rem->neg = lhs_neg & !!dest_rem->len;
+    } else
+    #endif
+    {
+        mpz_divmod_schoolbook(dest_quo, dest_rem, lhs, rhs);
+    }
 
     // check signs and do Python style modulo
-    if (lhs->neg != rhs->neg) {
+    if (lhs_neg != rhs->neg) {
         dest_quo->neg = !!dest_quo->len;
         if (!mpz_is_zero(dest_rem)) {
             mpz_t mpzone;
@@ -1667,6 +2266,82 @@ char *mpz_as_str(const mpz_t *i, unsigned int base) {
 }
 #endif
 
+/* writes the digits of |z| in the given base to s, least significant first,
+   adding leading zeros to make at least pad characters; returns the end of s
+   each pass divides by chunk_base = base ** chunk_chars, the largest power that fits in a digit
+*/
+static char *mpz_as_str_chunks(const mpz_t *z, unsigned int base, mpz_dig_t chunk_base, size_t chunk_chars, char base_char, size_t pad, char *s) {
+    char *start = s;
+    size_t ilen = z->len;
+
+    // make a copy of mpz digits, so we can do the div/mod calculation
+    mpz_dig_t *dig = m_new(mpz_dig_t, ilen);
+    memcpy(dig, z->dig, ilen * sizeof(mpz_dig_t));
+
+    while (ilen > 0) {
+        mpz_dbl_dig_t a = 0;
+
+        // compute next remainder
+        for (mpz_dig_t *d = dig + ilen; --d >= dig;) {
+            a = (a << DIG_SIZE) | *d;
+            *d = a / chunk_base;
+            a %= chunk_base;
+        }
+        while (ilen > 0 && dig[ilen - 1] == 0) {
+            --ilen;
+        }
+
+        // convert to characters, only leaving out the leading zeros of the last chunk
+        for (size_t n = 0; n < chunk_chars && (ilen > 0 || a != 0); ++n) {
+            char c = '0' + a % base;
+            if (c > '9') {
+                c += base_char - '9' - 1;
+            }
+            *s++ = c;
+            a /= base;
+        }
+    }
+
+    // free the copy of the digits array
+    m_del(mpz_dig_t, dig, z->len);
+
+    while ((size_t)(s - start) < pad) {
+        *s++ = '0';
+    }
+
+    return s;
+}
+
+#if MICROPY_OPT_MPZ_SUBQUADRATIC
+/* like mpz_as_str_chunks, but splits z in two by pows[level - 1] = chunk_base ** (2 ** (level - 1))
+   and converts each half recursively
+*/
+static char *mpz_as_str_dc(const mpz_t *z, const mpz_t *pows, size_t level, unsigned int base, mpz_dig_t chunk_base, size_t chunk_chars, char base_char, size_t pad, char *s) {
+    if (level == 0 || z->len < MPZ_STR_DC_THRESHOLD) {
+        return mpz_as_str_chunks(z, base, chunk_base, chunk_chars, base_char, pad, s);
+    }
+
+    --level;
+    mpz_t quo, rem;
+    mpz_init_zero(&quo);
+    mpz_init_zero(&rem);
+    mpz_divmod_inpl(&quo, &rem, z, &pows[level]);
+
+    // the low half has all of its characters unless it is the whole number
+    size_t width = chunk_chars << level;
+    if (mpz_is_zero(&quo)) {
+        s = mpz_as_str_dc(&rem, pows, level, base, chunk_base, chunk_chars, base_char, pad, s);
+    } else {
+        s = mpz_as_str_dc(&rem, pows, level, base, chunk_base, chunk_chars, base_char, width, s);
+        s = mpz_as_str_dc(&quo, pows, level, base, chunk_base, chunk_chars, base_char, pad > width ? pad - width : 0, s);
+    }
+
+    mpz_deinit(&quo);
+    mpz_deinit(&rem);
+    return s;
+}
+#endif
+
 // assumes enough space in str as calculated by mp_int_format_size
 // base must be between 2 and 32 inclusive
 // returns length of string, not including null byte
@@ -1688,48 +2363,55 @@ size_t mpz_as_str_inpl(const mpz_t *i, unsigned int base, const char *prefix, ch
         return s - str;
     }
 
-    // make a copy of mpz digits, so we can do the div/mod calculation
-    mpz_dig_t *dig = m_new(mpz_dig_t, ilen);
-    memcpy(dig, i->dig, ilen * sizeof(mpz_dig_t));
-
-    // convert
-    char *last_comma = str;
-    bool done;
-    do {
-        mpz_dig_t *d = dig + ilen;
-        mpz_dbl_dig_t a = 0;
+    // convert several characters per pass over the digits
+    mpz_dig_t chunk_base = base;
+    size_t chunk_chars = 1;
+    while ((mpz_dbl_dig_t)chunk_base * base <= DIG_MASK) {
+        chunk_base *= base;
+        ++chunk_chars;
+    }
 
-        // compute next remainder
-        while (--d >= dig) {
-            a = (a << DIG_SIZE) | *d;
-            *d = a / base;
-            a %= base;
+    #if MICROPY_OPT_MPZ_SUBQUADRATIC
+    if (ilen >= MPZ_STR_DC_THRESHOLD) {
+        // pows[n] = chunk_base ** (2 ** n), up to about the size of i
+        size_t max_levels = 2;
+        for (size_t n = ilen; n > 0; n >>= 1) {
+            ++max_levels;
+        }
+        mpz_t *pows = m_new(mpz_t, max_levels);
+        mpz_init_from_int(&pows[0], chunk_base);
+        size_t levels = 1;
+        while (levels < max_levels && 2 * pows[levels - 1].len <= ilen) {
+            mpz_init_zero(&pows[levels]);
+            mpz_mul_inpl(&pows[levels], &pows[levels - 1], &pows[levels - 1]);
+            ++levels;
         }
 
-        // convert to character
-        a += '0';
-        if (a > '9') {
-            a += base_char - '9' - 1;
+        mpz_t z;
+        mpz_init_view(&z, i, 0, ilen);
+        s = mpz_as_str_dc(&z, pows, levels, base, chunk_base, chunk_chars, base_char, 0, s);
+
+        for (size_t n = 0; n < levels; ++n) {
+            mpz_deinit(&pows[n]);
         }
-        *s++ = a;
-
-        // check if number is zero
-        done = true;
-        for (d = dig; d < dig + ilen; ++d) {
-            if (*d != 0) {
-                done = false;
-                break;
+        m_del(mpz_t, pows, max_levels);
+    } else
+    #endif
+    {
+        s = mpz_as_str_chunks(i, base, chunk_base, chunk_chars, base_char, 0, s);
+    }
+
+    // insert a comma between each group of 3 characters, working back from the end
+    if (comma) {
+        size_t n_char = s - str;
+        for (size_t n = n_char - 1; n > 0; --n) {
+            str[n + n / 3] = str[n];
+            if (n % 3 == 0) {
+                str[n + n / 3 - 1] = comma;
             }
         }
-        if (!done && comma && (s - last_comma) == 3) {
-            *s++ = comma;
-            last_comma = s;
-        }
+        s += (n_char - 1) / 3;
     }
-    while (!done);
-
-    // free the copy of the digits array
-    m_del(mpz_dig_t, dig, ilen);
 
     if (prefix) {
         const char *p = &prefix[strlen(prefix)];
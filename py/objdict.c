@@ -132,26 +132,19 @@ static void dict_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_
 // This is a helper function to initialize an empty, but typed dictionary with
 // a given number of slots.
 static mp_obj_t dict_new_typed(const mp_obj_type_t *type, const size_t n) {
-    mp_obj_t dict_out = mp_obj_new_dict(n);
-    mp_obj_dict_t *dict = MP_OBJ_TO_PTR(dict_out);
-    dict->base.type = type;
+    mp_obj_dict_t *dict = mp_obj_malloc(mp_obj_dict_t, type);
     #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
     if (type == &mp_type_ordereddict) {
-        dict->map.is_ordered = 1;
+        mp_map_init_ordered(&dict->map, n);
+        return MP_OBJ_FROM_PTR(dict);
     }
     #endif
-    return dict_out;
+    mp_map_init(&dict->map, n);
+    return MP_OBJ_FROM_PTR(dict);
 }
 
 mp_obj_t mp_obj_dict_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *args) {
-    mp_obj_t dict_out = mp_obj_new_dict(0);
-    mp_obj_dict_t *dict = MP_OBJ_TO_PTR(dict_out);
-    dict->base.type = type;
-    #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
-    if (type == &mp_type_ordereddict) {
-        dict->map.is_ordered = 1;
-    }
-    #endif
+    mp_obj_t dict_out = dict_new_typed(type, 0);
     if (n_args > 0 || n_kw > 0) {
         mp_obj_t args2[2] = {dict_out, args[0]}; // args[0] is always valid, even if it's not a positional arg
         mp_map_t kwargs;
@@ -171,7 +164,7 @@ static mp_obj_t dict_unary_op(mp_unary_op_t op, mp_obj_t self_in) {
             return MP_OBJ_NEW_SMALL_INT(self->map.used);
         #if MICROPY_PY_SYS_GETSIZEOF
         case MP_UNARY_OP_SIZEOF: {
-            size_t sz = sizeof(*self) + sizeof(*self->map.table) * self->map.alloc;
+            size_t sz = sizeof(*self) + mp_map_table_size(&self->map);
             return MP_OBJ_NEW_SMALL_INT(sz);
         }
         #endif
@@ -301,15 +294,19 @@ mp_obj_t mp_obj_dict_copy(mp_obj_t self_in) {
     mp_check_self(mp_obj_is_dict_or_ordereddict(self_in));
     // CIRCUITPY-CHANGE
     mp_obj_dict_t *self = native_dict(self_in);
-    mp_obj_t other_out = mp_obj_new_dict(self->map.alloc);
+    mp_obj_t other_out = mp_obj_new_dict(0);
     // CIRCUITPY-CHANGE
     mp_obj_dict_t *other = native_dict(other_out);
     other->base.type = self->base.type;
+    if (self->map.is_ordered) {
+        mp_map_init_ordered(&other->map, self->map.alloc);
+    } else {
+        mp_map_init(&other->map, self->map.alloc);
+    }
     other->map.used = self->map.used;
     other->map.all_keys_are_qstrs = self->map.all_keys_are_qstrs;
-    other->map.is_fixed = 0;
-    other->map.is_ordered = self->map.is_ordered;
-    memcpy(other->map.table, self->map.table, self->map.alloc * sizeof(mp_map_elem_t));
+    // Copies the hashes and buckets of a map that isn't ordered too.
+    memcpy(other->map.table, self->map.table, mp_map_table_size(&self->map));
     return other_out;
 }
 static MP_DEFINE_CONST_FUN_OBJ_1(dict_copy_obj, mp_obj_dict_copy);
@@ -412,10 +409,19 @@ static mp_obj_t dict_popitem(mp_obj_t self_in) {
     #endif
     mp_map_elem_t *next = dict_iter_next(self, &cur);
     assert(next);
-    self->map.used--;
     mp_obj_t items[] = {next->key, next->value};
-    next->key = MP_OBJ_SENTINEL; // must mark key as sentinel to indicate that it was deleted
-    next->value = MP_OBJ_NULL;
+    #if MICROPY_OPT_MAP_ROBIN_HOOD
+    if (!self->map.is_ordered) {
+        // The key's bucket has to be emptied too.
+        mp_map_lookup(&self->map, items[0], MP_MAP_LOOKUP_REMOVE_IF_FOUND);
+        next->value = MP_OBJ_NULL;
+    } else
+    #endif
+    {
+        self->map.used--;
+        next->key = MP_OBJ_SENTINEL; // must mark key as sentinel to indicate that it was deleted
+        next->value = MP_OBJ_NULL;
+    }
     mp_obj_t tuple = mp_obj_new_tuple(2, items);
 
     return tuple;
@@ -35,6 +35,7 @@
 #include "py/runtime.h"
 #include "py/bc.h"
 #include "py/cstack.h"
+#include "py/gc.h"
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
 #define DEBUG_PRINT (1)
@@ -435,6 +436,13 @@ mp_obj_t mp_obj_new_fun_bc(const mp_obj_t *def_args, const byte *code, const mp_
     o->bytecode = code;
     o->context = context;
     o->child_table = child_table;
+    #if MICROPY_OPT_INLINE_CACHE
+    o->inline_cache = NULL;
+    #endif
+    #if MICROPY_OPT_QUICKEN
+    // Bytecode outside the heap may be in flash.
+    o->quicken = gc_nbytes(code) != 0;
+    #endif
     if (def_pos_args != NULL) {
         memcpy(o->extra_args, def_pos_args->items, n_def_args * sizeof(mp_obj_t));
     }
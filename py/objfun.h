@@ -37,6 +37,12 @@ typedef struct _mp_obj_fun_bc_t {
     #if MICROPY_PY_SYS_SETTRACE
     const struct _mp_raw_code_t *rc;
     #endif
+    #if MICROPY_OPT_INLINE_CACHE
+    struct _mp_inline_cache_t *inline_cache;    // lookups made by the bytecode, allocated when first used
+    #endif
+    #if MICROPY_OPT_QUICKEN
+    bool quicken;                               // whether the VM may rewrite the bytecode
+    #endif
     // the following extra_args array is allocated space to take (in order):
     //  - values of positional default args (if any)
     //  - a single slot for default kw args dict (if it has them)
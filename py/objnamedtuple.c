@@ -50,15 +50,14 @@ size_t mp_obj_namedtuple_find_field(const mp_obj_namedtuple_type_t *type, qstr n
 static mp_obj_t namedtuple_asdict(mp_obj_t self_in) {
     mp_obj_namedtuple_t *self = MP_OBJ_TO_PTR(self_in);
     const qstr *fields = ((mp_obj_namedtuple_type_t *)self->tuple.base.type)->fields;
-    mp_obj_t dict = mp_obj_new_dict(self->tuple.len);
-    mp_obj_dict_t *dictObj = MP_OBJ_TO_PTR(dict);
     #if MICROPY_PY_COLLECTIONS_ORDEREDDICT
     // make it an OrderedDict
+    mp_obj_t dict = mp_obj_new_dict(0);
+    mp_obj_dict_t *dictObj = MP_OBJ_TO_PTR(dict);
     dictObj->base.type = &mp_type_ordereddict;
-    dictObj->map.is_ordered = 1;
+    mp_map_init_ordered(&dictObj->map, self->tuple.len);
     #else
-    dictObj->base.type = &mp_type_dict;
-    dictObj->map.is_ordered = 0;
+    mp_obj_t dict = mp_obj_new_dict(self->tuple.len);
     #endif
 
     for (size_t i = 0; i < self->tuple.len; ++i) {
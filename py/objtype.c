@@ -1113,6 +1113,11 @@ static void type_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
     } else {
         // delete/store attribute
 
+        #if MICROPY_OPT_INLINE_CACHE
+        // Methods cached from this class or its subclasses may no longer be found.
+        MP_STATE_VM(inline_cache_version)++;
+        #endif
+
         if (MP_OBJ_TYPE_HAS_SLOT(self, locals_dict)) {
             assert(mp_obj_is_dict_or_ordereddict(MP_OBJ_FROM_PTR(MP_OBJ_TYPE_GET_SLOT(self, locals_dict)))); // MicroPython restriction, for now
             mp_map_t *locals_map = &MP_OBJ_TYPE_GET_SLOT(self, locals_dict)->map;
@@ -856,6 +856,9 @@ mp_obj_t mp_raw_code_save_fun_to_bytes(const mp_module_constants_t *consts, cons
     // Skip pass source code info and cell info.
     // Then ip points to the start of the opcodes.
     ip += n_info + n_cell;
+    #if MICROPY_OPT_QUICKEN
+    size_t opcodes_offset = ip - fun_data;
+    #endif
 
     // Decode bytecode.
     while (ip < fun_data_top) {
@@ -912,6 +915,18 @@ mp_obj_t mp_raw_code_save_fun_to_bytes(const mp_module_constants_t *consts, cons
     // Save function code.
     mp_print_bytes(&print, fun_data, fun_data_len);
 
+    #if MICROPY_OPT_QUICKEN
+    // Put back the generic form of any instructions the VM has specialised.
+    byte *code = (byte *)vstr.buf + vstr.len - fun_data_len;
+    for (byte *op_ptr = code + opcodes_offset; op_ptr < code + fun_data_len;) {
+        mp_opcode_t op = mp_opcode_decode(op_ptr);
+        if (MP_BC_IS_QUICK(op.opcode)) {
+            *op_ptr = mp_bc_quick_generic[op.opcode - MP_BC_QUICK];
+        }
+        op_ptr += op.size;
+    }
+    #endif
+
     // Create and return bytes representing the .mpy data.
     return mp_obj_new_bytes_from_vstr(&vstr);
 }
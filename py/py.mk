@@ -146,6 +146,7 @@ PY_CORE_O_BASENAME = $(addprefix py/,\
 	parsenumbase.o \
 	parsenum.o \
 	proto.o \
+	inlinecache.o \
 	emitglue.o \
 	persistentcode.o \
 	runtime.o \
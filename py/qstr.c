@@ -60,13 +60,17 @@
 // allocated pool is twice this size.  The value here must be <= MP_QSTRnumber_of.
 #define MICROPY_ALLOC_QSTR_ENTRIES_INIT (10)
 
-// this must match the equivalent function in makeqstrdata.py
-size_t qstr_compute_hash(const byte *data, size_t len) {
+// Returns the hash of data before it's cut down to fit in qstr_hash_t.
+static size_t qstr_compute_full_hash(const byte *data, size_t len) {
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
     size_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
+    return hash;
+}
+
+static size_t qstr_mask_hash(size_t hash) {
     hash &= Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
@@ -75,6 +79,11 @@ size_t qstr_compute_hash(const byte *data, size_t len) {
     return hash;
 }
 
+// this must match the equivalent function in makeqstrdata.py
+size_t qstr_compute_hash(const byte *data, size_t len) {
+    return qstr_mask_hash(qstr_compute_full_hash(data, len));
+}
+
 // The first pool is the static qstr table. The contents must remain stable as
 // it is part of the .mpy ABI. See the top of py/persistentcode.c and
 // static_qstr_list in makeqstrdata.py. This pool is unsorted (although in a
@@ -202,10 +211,31 @@ extern const qstr_pool_t MICROPY_QSTR_EXTRA_POOL;
 #define CONST_POOL mp_qstr_const_pool
 #endif
 
+#if MICROPY_OPT_QSTR_INDEX
+// The qstrs added at runtime are also found through a hash table of their
+// ids, so interning a string doesn't compare it with each of them in turn.
+// The qstrs in ROM are still looked for in their pools. The table holds all
+// of the qstrs added at runtime or, if there wasn't memory for it, is NULL
+// and the pools are searched instead until it can be made.
+
+#define QSTR_INDEX_MIN_SLOTS (32)
+
+typedef struct _qstr_index_t {
+    size_t mask; // Number of slots minus one.
+    size_t used;
+    qstr slot[]; // MP_QSTRnull when empty.
+} qstr_index_t;
+
+MP_REGISTER_ROOT_POINTER(struct _qstr_index_t *qstr_index);
+#endif
+
 // CIRCUITPY-CHANGE: provide separate reset function
 void qstr_reset(void) {
     MP_STATE_VM(last_pool) = (qstr_pool_t *)&CONST_POOL; // we won't modify the const_pool since it has no allocated room left
     MP_STATE_VM(qstr_last_chunk) = NULL;
+    #if MICROPY_OPT_QSTR_INDEX
+    MP_STATE_VM(qstr_index) = NULL;
+    #endif
 }
 
 void qstr_init(void) {
@@ -228,10 +258,86 @@ static const qstr_pool_t *find_qstr(qstr *q) {
     return pool;
 }
 
+#if MICROPY_OPT_QSTR_INDEX
+static void qstr_index_insert(qstr_index_t *index, qstr q, size_t full_hash) {
+    size_t pos = full_hash & index->mask;
+    while (index->slot[pos] != MP_QSTRnull) {
+        pos = (pos + 1) & index->mask;
+    }
+    index->slot[pos] = q;
+    index->used++;
+}
+
+// Makes a table big enough for the qstrs added at runtime and puts them in
+// it, or sets the table to NULL if there isn't enough memory.
+static void qstr_index_rebuild(void) {
+    size_t n_qstr = QSTR_TOTAL() - (CONST_POOL.total_prev_len + CONST_POOL.len);
+    size_t n_slots = QSTR_INDEX_MIN_SLOTS;
+    while (n_slots < n_qstr * 4) {
+        n_slots *= 2;
+    }
+    // The old table isn't freed because a thread without the qstr mutex may
+    // be looking in it.
+    size_t n_bytes = sizeof(qstr_index_t) + n_slots * sizeof(qstr);
+    qstr_index_t *index = m_malloc_maybe(n_bytes);
+    if (index != NULL) {
+        memset(index, 0, n_bytes);
+        index->mask = n_slots - 1;
+        for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != &CONST_POOL; pool = pool->prev) {
+            for (size_t at = 0; at < pool->len; at++) {
+                size_t full_hash = qstr_compute_full_hash((const byte *)pool->qstrs[at], pool->lengths[at]);
+                qstr_index_insert(index, pool->total_prev_len + at, full_hash);
+            }
+        }
+    }
+    MP_STATE_VM(qstr_index) = index;
+}
+
+// qstr_mutex must be taken while in this function
+static void qstr_index_add(qstr q, size_t full_hash) {
+    qstr_index_t *index = MP_STATE_VM(qstr_index);
+    if (index == NULL || (index->used + 1) * 2 > index->mask + 1) {
+        // Keep the table at most half full so that the runs of used slots are short.
+        qstr_index_rebuild();
+    } else {
+        qstr_index_insert(index, q, full_hash);
+    }
+}
+
+static qstr qstr_index_find(const qstr_index_t *index, const char *str, size_t str_len, size_t full_hash) {
+    #if MICROPY_QSTR_BYTES_IN_HASH
+    size_t str_hash = qstr_mask_hash(full_hash);
+    #endif
+    for (size_t pos = full_hash & index->mask;; pos = (pos + 1) & index->mask) {
+        qstr q = index->slot[pos];
+        if (q == MP_QSTRnull) {
+            return MP_QSTRnull;
+        }
+        size_t at = q;
+        const qstr_pool_t *pool = find_qstr(&at);
+        if (
+            #if MICROPY_QSTR_BYTES_IN_HASH
+            pool->hashes[at] == str_hash &&
+            #endif
+            pool->lengths[at] == str_len
+            && memcmp(pool->qstrs[at], str, str_len) == 0) {
+            return q;
+        }
+    }
+}
+#endif
+
 // qstr_mutex must be taken while in this function
 static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
+    #if MICROPY_OPT_QSTR_INDEX
+    size_t full_hash = qstr_compute_full_hash((const byte *)q_ptr, len);
+    #endif
     #if MICROPY_QSTR_BYTES_IN_HASH
+    #if MICROPY_OPT_QSTR_INDEX
+    mp_uint_t hash = qstr_mask_hash(full_hash);
+    #else
     mp_uint_t hash = qstr_compute_hash((const byte *)q_ptr, len);
+    #endif
     DEBUG_printf("QSTR: add hash=%d len=%d data=%.*s\n", hash, len, len, q_ptr);
     #else
     DEBUG_printf("QSTR: add len=%d data=%.*s\n", len, len, q_ptr);
@@ -283,9 +389,14 @@ static qstr qstr_add(mp_uint_t len, const char *q_ptr) {
     MP_STATE_VM(last_pool)->lengths[at] = len;
     MP_STATE_VM(last_pool)->qstrs[at] = q_ptr;
     MP_STATE_VM(last_pool)->len++;
+    qstr q = MP_STATE_VM(last_pool)->total_prev_len + at;
+
+    #if MICROPY_OPT_QSTR_INDEX
+    qstr_index_add(q, full_hash);
+    #endif
 
     // return id for the newly-added qstr
-    return MP_STATE_VM(last_pool)->total_prev_len + at;
+    return q;
 }
 
 qstr qstr_find_strn(const char *str, size_t str_len) {
@@ -294,13 +405,31 @@ qstr qstr_find_strn(const char *str, size_t str_len) {
         return MP_QSTR_;
     }
 
+    const qstr_pool_t *pool = MP_STATE_VM(last_pool);
+
+    #if MICROPY_OPT_QSTR_INDEX
+    // work out hash of str
+    size_t full_hash = qstr_compute_full_hash((const byte *)str, str_len);
     #if MICROPY_QSTR_BYTES_IN_HASH
+    size_t str_hash = qstr_mask_hash(full_hash);
+    #endif
+
+    const qstr_index_t *index = MP_STATE_VM(qstr_index);
+    if (index != NULL) {
+        qstr q = qstr_index_find(index, str, str_len, full_hash);
+        if (q != MP_QSTRnull) {
+            return q;
+        }
+        // only the pools in ROM are left to search
+        pool = &CONST_POOL;
+    }
+    #elif MICROPY_QSTR_BYTES_IN_HASH
     // work out hash of str
     size_t str_hash = qstr_compute_hash((const byte *)str, str_len);
     #endif
 
     // search pools for the data
-    for (const qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+    for (; pool != NULL; pool = pool->prev) {
         size_t low = 0;
         size_t high = pool->len - 1;
 
@@ -468,6 +597,11 @@ void qstr_pool_info(size_t *n_pool, size_t *n_qstr, size_t *n_str_data_bytes, si
                 + sizeof(qstr_len_t)) * pool->alloc;
         #endif
     }
+    #if MICROPY_OPT_QSTR_INDEX && MICROPY_ENABLE_GC
+    if (MP_STATE_VM(qstr_index) != NULL) {
+        *n_total_bytes += gc_nbytes(MP_STATE_VM(qstr_index));
+    }
+    #endif
     *n_total_bytes += *n_str_data_bytes;
     QSTR_EXIT();
 }
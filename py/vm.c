@@ -32,7 +32,10 @@
 #include "py/emitglue.h"
 #include "py/objtype.h"
 #include "py/objfun.h"
+#include "py/objlist.h"
+#include "py/inlinecache.h"
 #include "py/runtime.h"
+#include "py/smallint.h"
 #include "py/bc0.h"
 #include "py/profile.h"
 
@@ -205,6 +208,76 @@ static mp_obj_t get_active_exception(mp_exc_stack_t *exc_sp, mp_exc_stack_t *exc
     return MP_OBJ_NULL;
 }
 
+#if MICROPY_OPT_QUICKEN
+
+#if MICROPY_PY_SYS_SETTRACE
+#error "MICROPY_OPT_QUICKEN can't be used with MICROPY_PY_SYS_SETTRACE"
+#endif
+
+// Without the GIL another thread may quicken an instruction between it being
+// dispatched and its handler looking at the opcode. The handlers for computed
+// gotos allow for that.
+#if MICROPY_PY_THREAD && !MICROPY_PY_THREAD_GIL && !MICROPY_OPT_COMPUTED_GOTO
+#error "MICROPY_OPT_QUICKEN needs MICROPY_OPT_COMPUTED_GOTO when threads run without the GIL"
+#endif
+
+#if MICROPY_PY_BUILTINS_FLOAT
+// Whether the float instructions can do lhs op rhs: at least one is a float
+// and the other is a float or a small int, which converts exactly as the
+// generic operation would.
+static inline bool vm_quick_float_operands(mp_obj_t lhs, mp_obj_t rhs) {
+    return (mp_obj_is_float(lhs) && (mp_obj_is_float(rhs) || mp_obj_is_small_int(rhs)))
+           || (mp_obj_is_small_int(lhs) && mp_obj_is_float(rhs));
+}
+
+static inline mp_float_t vm_quick_float_get(mp_obj_t o) {
+    return mp_obj_is_small_int(o) ? (mp_float_t)MP_OBJ_SMALL_INT_VALUE(o) : mp_obj_float_get(o);
+}
+#endif
+
+// Returns the instruction specialised for doing the binary operation op on
+// lhs and rhs, or op itself if there isn't one.
+static byte vm_quicken_binary_op(byte op, mp_obj_t lhs, mp_obj_t rhs) {
+    if (mp_obj_is_small_int(lhs) && mp_obj_is_small_int(rhs)) {
+        switch (op - MP_BC_BINARY_OP_MULTI) {
+            case MP_BINARY_OP_ADD:
+                return MP_BC_BINARY_OP_INT_ADD;
+            case MP_BINARY_OP_INPLACE_ADD:
+                return MP_BC_BINARY_OP_INT_INPLACE_ADD;
+            case MP_BINARY_OP_SUBTRACT:
+                return MP_BC_BINARY_OP_INT_SUBTRACT;
+            case MP_BINARY_OP_INPLACE_SUBTRACT:
+                return MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT;
+            case MP_BINARY_OP_LESS:
+                return MP_BC_BINARY_OP_INT_LESS;
+            case MP_BINARY_OP_MORE:
+                return MP_BC_BINARY_OP_INT_MORE;
+            case MP_BINARY_OP_EQUAL:
+                return MP_BC_BINARY_OP_INT_EQUAL;
+            case MP_BINARY_OP_NOT_EQUAL:
+                return MP_BC_BINARY_OP_INT_NOT_EQUAL;
+        }
+    #if MICROPY_PY_BUILTINS_FLOAT
+    } else if (vm_quick_float_operands(lhs, rhs)) {
+        switch (op - MP_BC_BINARY_OP_MULTI) {
+            case MP_BINARY_OP_ADD:
+                return MP_BC_BINARY_OP_FLOAT_ADD;
+            case MP_BINARY_OP_INPLACE_ADD:
+                return MP_BC_BINARY_OP_FLOAT_INPLACE_ADD;
+            case MP_BINARY_OP_SUBTRACT:
+                return MP_BC_BINARY_OP_FLOAT_SUBTRACT;
+            case MP_BINARY_OP_MULTIPLY:
+                return MP_BC_BINARY_OP_FLOAT_MULTIPLY;
+            case MP_BINARY_OP_TRUE_DIVIDE:
+                return MP_BC_BINARY_OP_FLOAT_TRUE_DIVIDE;
+        }
+    #endif
+    }
+    return op;
+}
+
+#endif // MICROPY_OPT_QUICKEN
+
 // fastn has items in reverse order (fastn[0] is local[0], fastn[-1] is local[1], etc)
 // sp points to bottom of stack which grows up
 // returns:
@@ -265,6 +338,58 @@ mp_vm_return_kind_t MICROPY_WRAP_MP_EXECUTE_BYTECODE(mp_execute_bytecode)(mp_cod
     #define ENTRY_DEFAULT default
 #endif
 
+#if MICROPY_OPT_QUICKEN
+    // The generic form of op, which another thread may have quickened.
+    #define QUICK_GENERIC(op) (MP_BC_IS_QUICK(op) ? mp_bc_quick_generic[(op) - MP_BC_QUICK] : (op))
+    // Run by a quickened instruction whose operands aren't the types it's for:
+    // puts back the generic instruction and runs that. A quickened instruction
+    // doesn't look at its own opcode again because another thread running the
+    // same bytecode may have rewritten it since it was dispatched.
+    #define QUICK_DEOPT(generic) do { \
+        ip--; \
+        *(byte *)ip = (generic); \
+        DISPATCH(); \
+} while (0)
+    // Declares lhs_val and rhs_val for a binary operation on small ints.
+    #define QUICK_INT_OPERANDS(op) \
+    mp_obj_t rhs = TOP(); \
+    mp_obj_t lhs = sp[-1]; \
+    if (!mp_obj_is_small_int(lhs) || !mp_obj_is_small_int(rhs)) { \
+        QUICK_DEOPT(MP_BC_BINARY_OP_MULTI + (op)); \
+    } \
+    mp_int_t lhs_val = MP_OBJ_SMALL_INT_VALUE(lhs); \
+    mp_int_t rhs_val = MP_OBJ_SMALL_INT_VALUE(rhs)
+    // Both operands fit in a small int so val can't overflow an mp_int_t. When
+    // it doesn't fit in one the operands are still ints, so the instruction is
+    // kept and the generic operation makes a big int.
+    #define QUICK_INT_RESULT(op, val) do { \
+        mp_int_t quick_val = (val); \
+        sp--; \
+        if (MP_SMALL_INT_FITS(quick_val)) { \
+            SET_TOP(MP_OBJ_NEW_SMALL_INT(quick_val)); \
+        } else { \
+            MARK_EXC_IP_SELECTIVE(); \
+            SET_TOP(mp_binary_op((op), lhs, rhs)); \
+        } \
+        DISPATCH(); \
+} while (0)
+    // Declares lhs_val and rhs_val for a binary operation on floats.
+    #define QUICK_FLOAT_OPERANDS(op) \
+    mp_obj_t rhs = TOP(); \
+    mp_obj_t lhs = sp[-1]; \
+    if (!vm_quick_float_operands(lhs, rhs)) { \
+        QUICK_DEOPT(MP_BC_BINARY_OP_MULTI + (op)); \
+    } \
+    mp_float_t lhs_val = vm_quick_float_get(lhs); \
+    mp_float_t rhs_val = vm_quick_float_get(rhs)
+    #define QUICK_FLOAT_RESULT(val) do { \
+        MARK_EXC_IP_SELECTIVE(); \
+        sp--; \
+        SET_TOP(mp_obj_new_float(val)); \
+        DISPATCH(); \
+} while (0)
+#endif
+
     // nlr_raise needs to be implemented as a goto, so that the C compiler's flow analyser
     // sees that it's possible for us to jump from the dispatch loop to the exception
     // handler.  Without this, the code may have a different stack layout in the dispatch
@@ -410,7 +535,11 @@ dispatch_loop:
                 ENTRY(MP_BC_LOAD_GLOBAL): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
+                    #if MICROPY_OPT_INLINE_CACHE
+                    PUSH(mp_inline_cache_load_global(code_state->fun_bc, ip, qst));
+                    #else
                     PUSH(mp_load_global(qst));
+                    #endif
                     DISPATCH();
                 }
 
@@ -420,6 +549,9 @@ dispatch_loop:
                     DECODE_QSTR;
                     mp_obj_t top = TOP();
                     mp_obj_t obj;
+                    #if MICROPY_OPT_INLINE_CACHE
+                    obj = mp_inline_cache_load_attr(code_state->fun_bc, ip, top, qst);
+                    #else
                     #if MICROPY_OPT_LOAD_ATTR_FAST_PATH
                     // For the specific case of an instance type, it implements .attr
                     // and forwards to its members map. Attribute lookups on instance
@@ -437,6 +569,7 @@ dispatch_loop:
                     {
                         obj = mp_load_attr(top, qst);
                     }
+                    #endif
                     SET_TOP(obj);
                     DISPATCH();
                 }
@@ -444,7 +577,11 @@ dispatch_loop:
                 ENTRY(MP_BC_LOAD_METHOD): {
                     MARK_EXC_IP_SELECTIVE();
                     DECODE_QSTR;
+                    #if MICROPY_OPT_INLINE_CACHE
+                    mp_inline_cache_load_method(code_state->fun_bc, ip, *sp, qst, sp);
+                    #else
                     mp_load_method(*sp, qst, sp);
+                    #endif
                     sp += 1;
                     DISPATCH();
                 }
@@ -465,6 +602,11 @@ dispatch_loop:
                 ENTRY(MP_BC_LOAD_SUBSCR): {
                     MARK_EXC_IP_SELECTIVE();
                     mp_obj_t index = POP();
+                    #if MICROPY_OPT_QUICKEN
+                    if (code_state->fun_bc->quicken && mp_obj_is_type(TOP(), &mp_type_list) && mp_obj_is_small_int(index)) {
+                        ((byte *)ip)[-1] = MP_BC_LOAD_SUBSCR_LIST_INT;
+                    }
+                    #endif
                     SET_TOP(mp_obj_subscr(TOP(), index, MP_OBJ_SENTINEL));
                     DISPATCH();
                 }
@@ -1284,6 +1426,109 @@ yield:
                     mp_import_all(POP());
                     DISPATCH();
 
+                #if MICROPY_OPT_QUICKEN
+                ENTRY(MP_BC_BINARY_OP_INT_ADD): {
+                    QUICK_INT_OPERANDS(MP_BINARY_OP_ADD);
+                    QUICK_INT_RESULT(MP_BINARY_OP_ADD, lhs_val + rhs_val);
+                }
+
+                ENTRY(MP_BC_BINARY_OP_INT_INPLACE_ADD): {
+                    QUICK_INT_OPERANDS(MP_BINARY_OP_INPLACE_ADD);
+                    QUICK_INT_RESULT(MP_BINARY_OP_INPLACE_ADD, lhs_val + rhs_val);
+                }
+
+                ENTRY(MP_BC_BINARY_OP_INT_SUBTRACT): {
+                    QUICK_INT_OPERANDS(MP_BINARY_OP_SUBTRACT);
+                    QUICK_INT_RESULT(MP_BINARY_OP_SUBTRACT, lhs_val - rhs_val);
+                }
+
+                ENTRY(MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT): {
+                    QUICK_INT_OPERANDS(MP_BINARY_OP_INPLACE_SUBTRACT);
+                    QUICK_INT_RESULT(MP_BINARY_OP_INPLACE_SUBTRACT, lhs_val - rhs_val);
+                }
+
+                ENTRY(MP_BC_BINARY_OP_INT_LESS): {
+                    QUICK_INT_OPERANDS(MP_BINARY_OP_LESS);
+                    sp--;
+                    SET_TOP(mp_obj_new_bool(lhs_val < rhs_val));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_BINARY_OP_INT_MORE): {
+                    QUICK_INT_OPERANDS(MP_BINARY_OP_MORE);
+                    sp--;
+                    SET_TOP(mp_obj_new_bool(lhs_val > rhs_val));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_BINARY_OP_INT_EQUAL): {
+                    QUICK_INT_OPERANDS(MP_BINARY_OP_EQUAL);
+                    sp--;
+                    SET_TOP(mp_obj_new_bool(lhs_val == rhs_val));
+                    DISPATCH();
+                }
+
+                ENTRY(MP_BC_BINARY_OP_INT_NOT_EQUAL): {
+                    QUICK_INT_OPERANDS(MP_BINARY_OP_NOT_EQUAL);
+                    sp--;
+                    SET_TOP(mp_obj_new_bool(lhs_val != rhs_val));
+                    DISPATCH();
+                }
+
+                #if MICROPY_PY_BUILTINS_FLOAT
+                ENTRY(MP_BC_BINARY_OP_FLOAT_ADD): {
+                    QUICK_FLOAT_OPERANDS(MP_BINARY_OP_ADD);
+                    QUICK_FLOAT_RESULT(lhs_val + rhs_val);
+                }
+
+                ENTRY(MP_BC_BINARY_OP_FLOAT_INPLACE_ADD): {
+                    QUICK_FLOAT_OPERANDS(MP_BINARY_OP_INPLACE_ADD);
+                    QUICK_FLOAT_RESULT(lhs_val + rhs_val);
+                }
+
+                ENTRY(MP_BC_BINARY_OP_FLOAT_SUBTRACT): {
+                    QUICK_FLOAT_OPERANDS(MP_BINARY_OP_SUBTRACT);
+                    QUICK_FLOAT_RESULT(lhs_val - rhs_val);
+                }
+
+                ENTRY(MP_BC_BINARY_OP_FLOAT_MULTIPLY): {
+                    QUICK_FLOAT_OPERANDS(MP_BINARY_OP_MULTIPLY);
+                    QUICK_FLOAT_RESULT(lhs_val * rhs_val);
+                }
+
+                ENTRY(MP_BC_BINARY_OP_FLOAT_TRUE_DIVIDE): {
+                    QUICK_FLOAT_OPERANDS(MP_BINARY_OP_TRUE_DIVIDE);
+                    if (rhs_val == 0) {
+                        // Let the generic operation raise ZeroDivisionError.
+                        QUICK_DEOPT(MP_BC_BINARY_OP_MULTI + MP_BINARY_OP_TRUE_DIVIDE);
+                    }
+                    QUICK_FLOAT_RESULT(lhs_val / rhs_val);
+                }
+                #endif
+
+                ENTRY(MP_BC_LOAD_SUBSCR_LIST_INT): {
+                    mp_obj_t index = TOP();
+                    mp_obj_t base = sp[-1];
+                    if (!mp_obj_is_type(base, &mp_type_list) || !mp_obj_is_small_int(index)) {
+                        QUICK_DEOPT(MP_BC_LOAD_SUBSCR);
+                    }
+                    mp_obj_list_t *list = MP_OBJ_TO_PTR(base);
+                    mp_int_t i = MP_OBJ_SMALL_INT_VALUE(index);
+                    if (i < 0) {
+                        i += list->len;
+                    }
+                    sp--;
+                    if ((mp_uint_t)i < list->len) {
+                        SET_TOP(list->items[i]);
+                    } else {
+                        // Let the generic operation raise IndexError.
+                        MARK_EXC_IP_SELECTIVE();
+                        SET_TOP(mp_obj_subscr(base, index, MP_OBJ_SENTINEL));
+                    }
+                    DISPATCH();
+                }
+                #endif // MICROPY_OPT_QUICKEN
+
                 #if MICROPY_OPT_COMPUTED_GOTO
                 ENTRY(MP_BC_LOAD_CONST_SMALL_INT_MULTI):
                     PUSH(MP_OBJ_NEW_SMALL_INT((mp_int_t)ip[-1] - MP_BC_LOAD_CONST_SMALL_INT_MULTI - MP_BC_LOAD_CONST_SMALL_INT_MULTI_EXCESS));
@@ -1306,7 +1551,15 @@ yield:
                     MARK_EXC_IP_SELECTIVE();
                     mp_obj_t rhs = POP();
                     mp_obj_t lhs = TOP();
-                    SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                    #if MICROPY_OPT_QUICKEN
+                    byte op = QUICK_GENERIC(ip[-1]);
+                    if (code_state->fun_bc->quicken) {
+                        ((byte *)ip)[-1] = vm_quicken_binary_op(op, lhs, rhs);
+                    }
+                    #else
+                    byte op = ip[-1];
+                    #endif
+                    SET_TOP(mp_binary_op(op - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                     DISPATCH();
                 }
 
@@ -1329,7 +1582,13 @@ yield:
                     } else if (ip[-1] < MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM) {
                         mp_obj_t rhs = POP();
                         mp_obj_t lhs = TOP();
-                        SET_TOP(mp_binary_op(ip[-1] - MP_BC_BINARY_OP_MULTI, lhs, rhs));
+                        byte op = ip[-1];
+                        #if MICROPY_OPT_QUICKEN
+                        if (code_state->fun_bc->quicken) {
+                            ((byte *)ip)[-1] = vm_quicken_binary_op(op, lhs, rhs);
+                        }
+                        #endif
+                        SET_TOP(mp_binary_op(op - MP_BC_BINARY_OP_MULTI, lhs, rhs));
                         DISPATCH();
                     } else
                 #endif // MICROPY_OPT_COMPUTED_GOTO
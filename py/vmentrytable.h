@@ -132,6 +132,24 @@ static entry_table_type const PLACE_IN_DTCM_DATA(entry_table[256]) = {
     [MP_BC_STORE_FAST_MULTI ... MP_BC_STORE_FAST_MULTI + MP_BC_LOAD_FAST_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_STORE_FAST_MULTI),
     [MP_BC_UNARY_OP_MULTI ... MP_BC_UNARY_OP_MULTI + MP_BC_UNARY_OP_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_UNARY_OP_MULTI),
     [MP_BC_BINARY_OP_MULTI ... MP_BC_BINARY_OP_MULTI + MP_BC_BINARY_OP_MULTI_NUM - 1] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_MULTI),
+    #if MICROPY_OPT_QUICKEN
+    [MP_BC_BINARY_OP_INT_ADD] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_INT_ADD),
+    [MP_BC_BINARY_OP_INT_INPLACE_ADD] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_INT_INPLACE_ADD),
+    [MP_BC_BINARY_OP_INT_SUBTRACT] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_INT_SUBTRACT),
+    [MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_INT_INPLACE_SUBTRACT),
+    [MP_BC_BINARY_OP_INT_LESS] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_INT_LESS),
+    [MP_BC_BINARY_OP_INT_MORE] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_INT_MORE),
+    [MP_BC_BINARY_OP_INT_EQUAL] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_INT_EQUAL),
+    [MP_BC_BINARY_OP_INT_NOT_EQUAL] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_INT_NOT_EQUAL),
+    #if MICROPY_PY_BUILTINS_FLOAT
+    [MP_BC_BINARY_OP_FLOAT_ADD] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_FLOAT_ADD),
+    [MP_BC_BINARY_OP_FLOAT_INPLACE_ADD] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_FLOAT_INPLACE_ADD),
+    [MP_BC_BINARY_OP_FLOAT_SUBTRACT] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_FLOAT_SUBTRACT),
+    [MP_BC_BINARY_OP_FLOAT_MULTIPLY] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_FLOAT_MULTIPLY),
+    [MP_BC_BINARY_OP_FLOAT_TRUE_DIVIDE] = COMPUTE_ENTRY(&& entry_MP_BC_BINARY_OP_FLOAT_TRUE_DIVIDE),
+    #endif
+    [MP_BC_LOAD_SUBSCR_LIST_INT] = COMPUTE_ENTRY(&& entry_MP_BC_LOAD_SUBSCR_LIST_INT),
+    #endif
 };
 
 // CIRCUITPY-CHANGE: #ifdef instead of #if
@@ -143,6 +143,7 @@ static void validate_clip_region(displayio_bitmap_t *bitmap, mp_obj_t clip0_tupl
 //|     angle: float,
 //|     scale: float,
 //|     skip_index: int,
+//|     bilinear: bool = False,
 //| ) -> None:
 //|     """Inserts the source bitmap region into the destination bitmap with rotation
 //|     (angle), scale and clipping (both on source and destination bitmaps).
@@ -174,7 +175,10 @@ static void validate_clip_region(displayio_bitmap_t *bitmap, mp_obj_t clip0_tupl
 //|     :param float scale: Scaling factor. Defaults to None which gets treated as 1.0 or same
 //|            as original source size.
 //|     :param int skip_index: Bitmap palette index in the source that will not be copied,
-//|            set to None to copy all pixels"""
+//|            set to None to copy all pixels
+//|     :param bool bilinear: Blend the four nearest source pixels instead of copying the nearest
+//|            one. Only used when both bitmaps have 16 bits per value, which are treated as
+//|            RGB565 colors."""
 //|     ...
 //|
 //|
@@ -182,7 +186,7 @@ static mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
     enum {ARG_dest_bitmap, ARG_source_bitmap,
           ARG_ox, ARG_oy, ARG_dest_clip0, ARG_dest_clip1,
           ARG_px, ARG_py, ARG_source_clip0, ARG_source_clip1,
-          ARG_angle, ARG_scale, ARG_skip_index};
+          ARG_angle, ARG_scale, ARG_skip_index, ARG_bilinear};
 
     static const mp_arg_t allowed_args[] = {
         {MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL}},
@@ -201,6 +205,7 @@ static mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
         {MP_QSTR_angle, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} }, // None convert to 0.0
         {MP_QSTR_scale, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} }, // None convert to 1.0
         {MP_QSTR_skip_index, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        {MP_QSTR_bilinear, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
     };
 
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
@@ -270,7 +275,8 @@ static mp_obj_t bitmaptools_obj_rotozoom(size_t n_args, const mp_obj_t *pos_args
         source_clip1_x, source_clip1_y,
         angle,
         scale,
-        skip_index, skip_index_none);
+        skip_index, skip_index_none,
+        args[ARG_bilinear].u_bool);
 
     return mp_const_none;
 }
@@ -676,6 +682,78 @@ static mp_obj_t bitmaptools_obj_draw_polygon(size_t n_args, const mp_obj_t *pos_
 
 MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_draw_polygon_obj, 0, bitmaptools_obj_draw_polygon);
 
+//| def fill_polygon(
+//|     dest_bitmap: displayio.Bitmap,
+//|     xs: ReadableBuffer,
+//|     ys: ReadableBuffer,
+//|     value: int,
+//| ) -> None:
+//|     """Fill the inside of a polygon on provided bitmap with provided value. Pixels are filled
+//|     when they are inside using the non-zero winding rule, matching `vectorio.Polygon`.
+//|
+//|     :param bitmap dest_bitmap: Destination bitmap that will be written into
+//|     :param ReadableBuffer xs: x-pixel position of the polygon's vertices
+//|     :param ReadableBuffer ys: y-pixel position of the polygon's vertices
+//|     :param int value: Bitmap palette index that will be written into the
+//|            polygon in the destination bitmap
+//|
+//|     .. code-block:: Python
+//|
+//|        import displayio
+//|        import bitmaptools
+//|
+//|        bmp = displayio.Bitmap(128, 128, 3)
+//|        xs = bytes([4, 101, 101, 19])
+//|        ys = bytes([4, 19,  121, 101])
+//|        bitmaptools.fill_polygon(bmp, xs, ys, 1)
+//|        bitmaptools.draw_polygon(bmp, xs, ys, 2)
+//|     """
+//|     ...
+//|
+//|
+static mp_obj_t bitmaptools_obj_fill_polygon(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum {ARG_dest_bitmap, ARG_xs, ARG_ys, ARG_value};
+
+    static const mp_arg_t allowed_args[] = {
+        {MP_QSTR_dest_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL}},
+        {MP_QSTR_xs, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL}},
+        {MP_QSTR_ys, MP_ARG_REQUIRED | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL}},
+        {MP_QSTR_value, MP_ARG_REQUIRED | MP_ARG_INT, {.u_obj = MP_OBJ_NULL}},
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    displayio_bitmap_t *destination = MP_OBJ_TO_PTR(args[ARG_dest_bitmap].u_obj);     // the destination bitmap
+
+    mp_buffer_info_t xs_buf, ys_buf;
+    mp_get_buffer_raise(args[ARG_xs].u_obj, &xs_buf, MP_BUFFER_READ);
+    mp_get_buffer_raise(args[ARG_ys].u_obj, &ys_buf, MP_BUFFER_READ);
+    size_t xs_size = mp_binary_get_size('@', xs_buf.typecode, NULL);
+    size_t ys_size = mp_binary_get_size('@', ys_buf.typecode, NULL);
+    size_t xs_len = xs_buf.len / xs_size;
+    size_t ys_len = ys_buf.len / ys_size;
+    if (xs_size != ys_size) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Coordinate arrays types have different sizes"));
+    }
+    if (xs_len != ys_len) {
+        mp_raise_ValueError(MP_ERROR_TEXT("Coordinate arrays have different lengths"));
+    }
+    mp_arg_validate_int_max(xs_len, UINT16_MAX, MP_QSTR_xs);
+
+    uint32_t value, color_depth;
+    value = args[ARG_value].u_int;
+    color_depth = (1 << destination->bits_per_value);
+    if (color_depth <= value) {
+        mp_raise_ValueError(MP_ERROR_TEXT("out of range of target"));
+    }
+
+    common_hal_bitmaptools_fill_polygon(destination, xs_buf.buf, ys_buf.buf, xs_len, xs_size, value);
+
+    return mp_const_none;
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(bitmaptools_fill_polygon_obj, 0, bitmaptools_obj_fill_polygon);
+
 //| def arrayblit(
 //|     bitmap: displayio.Bitmap,
 //|     data: ReadableBuffer,
@@ -1107,6 +1185,7 @@ static const mp_rom_map_elem_t bitmaptools_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_boundary_fill), MP_ROM_PTR(&bitmaptools_boundary_fill_obj) },
     { MP_ROM_QSTR(MP_QSTR_draw_line), MP_ROM_PTR(&bitmaptools_draw_line_obj) },
     { MP_ROM_QSTR(MP_QSTR_draw_polygon), MP_ROM_PTR(&bitmaptools_draw_polygon_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fill_polygon), MP_ROM_PTR(&bitmaptools_fill_polygon_obj) },
     { MP_ROM_QSTR(MP_QSTR_draw_circle), MP_ROM_PTR(&bitmaptools_draw_circle_obj) },
     { MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&bitmaptools_blit_obj) },
     { MP_ROM_QSTR(MP_QSTR_dither), MP_ROM_PTR(&bitmaptools_dither_obj) },
@@ -29,6 +29,7 @@ static const mp_arg_t note_properties[] = {
     { MP_QSTR_ring_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_NONE } },
     { MP_QSTR_ring_waveform_loop_start, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(0) } },
     { MP_QSTR_ring_waveform_loop_end, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_INT(SYNTHIO_WAVEFORM_SIZE) } },
+    { MP_QSTR_bandlimited, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_ROM_FALSE } },
 };
 //| class Note:
 //|     def __init__(
@@ -48,6 +49,7 @@ static const mp_arg_t note_properties[] = {
 //|         ring_waveform: Optional[ReadableBuffer] = None,
 //|         ring_waveform_loop_start: BlockInput = 0,
 //|         ring_waveform_loop_end: BlockInput = waveform_max_length,
+//|         bandlimited: bool = False,
 //|     ) -> None:
 //|         """Construct a Note object, with a frequency in Hz, and optional panning, waveform, envelope, tremolo (volume change) and bend (frequency change).
 //|
@@ -264,6 +266,33 @@ MP_PROPERTY_GETSET(synthio_note_envelope_obj,
     (mp_obj_t)&synthio_note_get_envelope_obj,
     (mp_obj_t)&synthio_note_set_envelope_obj);
 
+//|     bandlimited: bool
+//|     """If True, the waveform is played with linear interpolation from a set of
+//|     progressively low-pass filtered copies, chosen according to the note's
+//|     current frequency. This greatly reduces the aliasing of high notes, at the
+//|     cost of about as much memory again as the waveform itself.
+//|
+//|     The filtered copies are made when the note is pressed or its waveform is
+//|     assigned. After changing the content of a waveform in place, assign it to
+//|     the note again. They only cover the whole waveform; when
+//|     ``waveform_loop_start`` or ``waveform_loop_end`` select part of it, that part
+//|     is played with linear interpolation only."""
+static mp_obj_t synthio_note_get_bandlimited(mp_obj_t self_in) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_synthio_note_get_bandlimited(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_note_get_bandlimited_obj, synthio_note_get_bandlimited);
+
+static mp_obj_t synthio_note_set_bandlimited(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_note_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_synthio_note_set_bandlimited(self, mp_obj_is_true(arg));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_note_set_bandlimited_obj, synthio_note_set_bandlimited);
+MP_PROPERTY_GETSET(synthio_note_bandlimited_obj,
+    (mp_obj_t)&synthio_note_get_bandlimited_obj,
+    (mp_obj_t)&synthio_note_set_bandlimited_obj);
+
 //|     ring_frequency: float
 //|     """The ring frequency of the note, in Hz. Zero disables.
 //|
@@ -389,6 +418,7 @@ static const mp_rom_map_elem_t synthio_note_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_waveform_loop_start), MP_ROM_PTR(&synthio_note_waveform_loop_start_obj) },
     { MP_ROM_QSTR(MP_QSTR_waveform_loop_end), MP_ROM_PTR(&synthio_note_waveform_loop_end_obj) },
     { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&synthio_note_envelope_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bandlimited), MP_ROM_PTR(&synthio_note_bandlimited_obj) },
     { MP_ROM_QSTR(MP_QSTR_amplitude), MP_ROM_PTR(&synthio_note_amplitude_obj) },
     { MP_ROM_QSTR(MP_QSTR_bend), MP_ROM_PTR(&synthio_note_bend_obj) },
     { MP_ROM_QSTR(MP_QSTR_ring_frequency), MP_ROM_PTR(&synthio_note_ring_frequency_obj) },
@@ -52,5 +52,8 @@ void common_hal_synthio_note_set_ring_waveform_loop_start(synthio_note_obj_t *se
 mp_obj_t common_hal_synthio_note_get_ring_waveform_loop_end(synthio_note_obj_t *self);
 void common_hal_synthio_note_set_ring_waveform_loop_end(synthio_note_obj_t *self, mp_obj_t value);
 
+bool common_hal_synthio_note_get_bandlimited(synthio_note_obj_t *self);
+void common_hal_synthio_note_set_bandlimited(synthio_note_obj_t *self, bool value);
+
 mp_obj_t common_hal_synthio_note_get_envelope_obj(synthio_note_obj_t *self);
 void common_hal_synthio_note_set_envelope(synthio_note_obj_t *self, mp_obj_t value);
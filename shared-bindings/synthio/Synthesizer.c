@@ -35,6 +35,9 @@
 //|         channel_count: int = 1,
 //|         waveform: Optional[ReadableBuffer] = None,
 //|         envelope: Optional[Envelope] = None,
+//|         voices: int = max_polyphony,
+//|         voice_stealing: VoiceStealing = VoiceStealing.NONE,
+//|         control_rate: Optional[int] = None,
 //|     ) -> None:
 //|         """Create a synthesizer object.
 //|
@@ -48,26 +51,41 @@
 //|         :param int channel_count: The number of output channels (1=mono, 2=stereo)
 //|         :param ReadableBuffer waveform: A single-cycle waveform. Default is a 50% duty cycle square wave. If specified, must be a ReadableBuffer of type 'h' (signed 16 bit)
 //|         :param Optional[Envelope] envelope: An object that defines the loudness of a note over time. The default envelope, `None` provides no ramping, voices turn instantly on and off.
+//|         :param int voices: The number of notes that can sound at once, from 1 to 255. More voices need more memory and CPU time, and each voice is mixed at a lower level to leave headroom for the others.
+//|         :param VoiceStealing voice_stealing: What to do when a note is pressed while all voices are in use.
+//|         :param Optional[int] control_rate: How many times per second to update blocks such as `LFO`, note filters and envelopes. Between updates, the loudness of each note changes smoothly instead of in steps. The default, `None`, updates them once per output buffer (every 256 samples) with no smoothing. The time between updates is limited to the range 16 to 256 samples. Higher rates need more CPU time.
 //|         """
 //|
 static mp_obj_t synthio_synthesizer_make_new(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
-    enum { ARG_sample_rate, ARG_channel_count, ARG_waveform, ARG_envelope };
+    enum { ARG_sample_rate, ARG_channel_count, ARG_waveform, ARG_envelope, ARG_voices, ARG_voice_stealing, ARG_control_rate };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 11025} },
         { MP_QSTR_channel_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1} },
         { MP_QSTR_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
         { MP_QSTR_envelope, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
+        { MP_QSTR_voices, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = CIRCUITPY_SYNTHIO_MAX_CHANNELS} },
+        { MP_QSTR_voice_stealing, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_FROM_PTR(&voice_stealing_NONE_obj) } },
+        { MP_QSTR_control_rate, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none } },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all_kw_array(n_args, n_kw, all_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
+    mp_int_t control_rate = 0;
+    if (args[ARG_control_rate].u_obj != mp_const_none) {
+        control_rate = mp_arg_validate_int_range(mp_obj_get_int(args[ARG_control_rate].u_obj), 1, args[ARG_sample_rate].u_int, MP_QSTR_control_rate);
+    }
+
     synthio_synthesizer_obj_t *self = mp_obj_malloc(synthio_synthesizer_obj_t, &synthio_synthesizer_type);
 
     common_hal_synthio_synthesizer_construct(self,
         args[ARG_sample_rate].u_int,
         args[ARG_channel_count].u_int,
         args[ARG_waveform].u_obj,
-        args[ARG_envelope].u_obj);
+        args[ARG_envelope].u_obj,
+        args[ARG_voices].u_int,
+        control_rate);
+    common_hal_synthio_synthesizer_set_voice_stealing(self,
+        cp_enum_value(&synthio_voice_stealing_type, args[ARG_voice_stealing].u_obj, MP_QSTR_voice_stealing));
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -262,6 +280,54 @@ static mp_obj_t synthio_synthesizer_obj_note_info(mp_obj_t self_in, mp_obj_t not
 }
 MP_DEFINE_CONST_FUN_OBJ_2(synthio_synthesizer_note_info_obj, synthio_synthesizer_obj_note_info);
 
+//|     voices: int
+//|     """The number of notes that can sound at once (read-only property)"""
+static mp_obj_t synthio_synthesizer_obj_get_voices(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_synthio_synthesizer_get_voices(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_voices_obj, synthio_synthesizer_obj_get_voices);
+
+MP_PROPERTY_GETTER(synthio_synthesizer_voices_obj,
+    (mp_obj_t)&synthio_synthesizer_get_voices_obj);
+
+//|     voice_stealing: VoiceStealing
+//|     """What to do when a note is pressed while all voices are playing notes that have not been released.
+//|
+//|     Voices with released notes are always reused first, starting with the quietest."""
+static mp_obj_t synthio_synthesizer_obj_get_voice_stealing(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    return cp_enum_find(&synthio_voice_stealing_type, common_hal_synthio_synthesizer_get_voice_stealing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_voice_stealing_obj, synthio_synthesizer_obj_get_voice_stealing);
+
+static mp_obj_t synthio_synthesizer_obj_set_voice_stealing(mp_obj_t self_in, mp_obj_t arg) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    common_hal_synthio_synthesizer_set_voice_stealing(self, cp_enum_value(&synthio_voice_stealing_type, arg, MP_QSTR_voice_stealing));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(synthio_synthesizer_set_voice_stealing_obj, synthio_synthesizer_obj_set_voice_stealing);
+
+MP_PROPERTY_GETSET(synthio_synthesizer_voice_stealing_obj,
+    (mp_obj_t)&synthio_synthesizer_get_voice_stealing_obj,
+    (mp_obj_t)&synthio_synthesizer_set_voice_stealing_obj);
+
+//|     control_rate: Optional[int]
+//|     """How many times per second blocks, note filters and envelopes are updated, or `None` to update them once per output buffer (read-only property)"""
+static mp_obj_t synthio_synthesizer_obj_get_control_rate(mp_obj_t self_in) {
+    synthio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    check_for_deinit(self);
+    mp_int_t control_rate = common_hal_synthio_synthesizer_get_control_rate(self);
+    return control_rate ? MP_OBJ_NEW_SMALL_INT(control_rate) : mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(synthio_synthesizer_get_control_rate_obj, synthio_synthesizer_obj_get_control_rate);
+
+MP_PROPERTY_GETTER(synthio_synthesizer_control_rate_obj,
+    (mp_obj_t)&synthio_synthesizer_get_control_rate_obj);
+
 //|     blocks: List[BlockInput]
 //|     """A list of blocks to advance whether or not they are associated with a playing note.
 //|
@@ -295,6 +361,9 @@ static const mp_rom_map_elem_t synthio_synthesizer_locals_dict_table[] = {
     // Properties
     { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&synthio_synthesizer_envelope_obj) },
     { MP_ROM_QSTR(MP_QSTR_max_polyphony), MP_ROM_INT(CIRCUITPY_SYNTHIO_MAX_CHANNELS) },
+    { MP_ROM_QSTR(MP_QSTR_voices), MP_ROM_PTR(&synthio_synthesizer_voices_obj) },
+    { MP_ROM_QSTR(MP_QSTR_voice_stealing), MP_ROM_PTR(&synthio_synthesizer_voice_stealing_obj) },
+    { MP_ROM_QSTR(MP_QSTR_control_rate), MP_ROM_PTR(&synthio_synthesizer_control_rate_obj) },
     { MP_ROM_QSTR(MP_QSTR_pressed), MP_ROM_PTR(&synthio_synthesizer_pressed_obj) },
     { MP_ROM_QSTR(MP_QSTR_note_info), MP_ROM_PTR(&synthio_synthesizer_note_info_obj) },
     { MP_ROM_QSTR(MP_QSTR_blocks), MP_ROM_PTR(&synthio_synthesizer_blocks_obj) },
@@ -13,7 +13,7 @@ extern const mp_obj_type_t synthio_synthesizer_type;
 
 void common_hal_synthio_synthesizer_construct(synthio_synthesizer_obj_t *self,
     uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj,
-    mp_obj_t envelope_obj);
+    mp_obj_t envelope_obj, mp_int_t voices, mp_int_t control_rate);
 void common_hal_synthio_synthesizer_deinit(synthio_synthesizer_obj_t *self);
 void common_hal_synthio_synthesizer_release(synthio_synthesizer_obj_t *self, mp_obj_t to_release);
 void common_hal_synthio_synthesizer_press(synthio_synthesizer_obj_t *self, mp_obj_t to_press);
@@ -22,3 +22,7 @@ void common_hal_synthio_synthesizer_release_all(synthio_synthesizer_obj_t *self)
 mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_obj_t *self);
 mp_obj_t common_hal_synthio_synthesizer_get_blocks(synthio_synthesizer_obj_t *self);
 envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_obj_t *self, mp_obj_t note, mp_float_t *vol_out);
+mp_int_t common_hal_synthio_synthesizer_get_voices(synthio_synthesizer_obj_t *self);
+synthio_voice_stealing_t common_hal_synthio_synthesizer_get_voice_stealing(synthio_synthesizer_obj_t *self);
+void common_hal_synthio_synthesizer_set_voice_stealing(synthio_synthesizer_obj_t *self, synthio_voice_stealing_t value);
+mp_int_t common_hal_synthio_synthesizer_get_control_rate(synthio_synthesizer_obj_t *self);
@@ -61,6 +61,32 @@ static MP_DEFINE_CONST_DICT(synthio_note_state_locals_dict, synthio_note_state_l
 MAKE_PRINTER(synthio, synthio_note_state);
 MAKE_ENUM_TYPE(synthio, EnvelopeState, synthio_note_state);
 
+//| class VoiceStealing:
+//|     """What a `Synthesizer` does when a note is pressed and all of its voices are
+//|     playing notes that have not been released"""
+//|
+//|     NONE: VoiceStealing
+//|     """The new note is not played"""
+//|     OLDEST: VoiceStealing
+//|     """The note that was pressed longest ago stops, and the new note takes its voice"""
+//|     QUIETEST: VoiceStealing
+//|     """The note with the lowest envelope level stops, and the new note takes its voice"""
+//|
+//|
+MAKE_ENUM_VALUE(synthio_voice_stealing_type, voice_stealing, NONE, SYNTHIO_VOICE_STEALING_NONE);
+MAKE_ENUM_VALUE(synthio_voice_stealing_type, voice_stealing, OLDEST, SYNTHIO_VOICE_STEALING_OLDEST);
+MAKE_ENUM_VALUE(synthio_voice_stealing_type, voice_stealing, QUIETEST, SYNTHIO_VOICE_STEALING_QUIETEST);
+
+MAKE_ENUM_MAP(synthio_voice_stealing) {
+    MAKE_ENUM_MAP_ENTRY(voice_stealing, NONE),
+    MAKE_ENUM_MAP_ENTRY(voice_stealing, OLDEST),
+    MAKE_ENUM_MAP_ENTRY(voice_stealing, QUIETEST),
+};
+
+static MP_DEFINE_CONST_DICT(synthio_voice_stealing_locals_dict, synthio_voice_stealing_locals_table);
+MAKE_PRINTER(synthio, synthio_voice_stealing);
+MAKE_ENUM_TYPE(synthio, VoiceStealing, synthio_voice_stealing);
+
 #define default_attack_time (MICROPY_FLOAT_CONST(0.1))
 #define default_decay_time (MICROPY_FLOAT_CONST(0.05))
 #define default_release_time (MICROPY_FLOAT_CONST(0.2))
@@ -322,6 +348,7 @@ static const mp_rom_map_elem_t synthio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_MidiTrack), MP_ROM_PTR(&synthio_miditrack_type) },
     { MP_ROM_QSTR(MP_QSTR_Note), MP_ROM_PTR(&synthio_note_type) },
     { MP_ROM_QSTR(MP_QSTR_EnvelopeState), MP_ROM_PTR(&synthio_note_state_type) },
+    { MP_ROM_QSTR(MP_QSTR_VoiceStealing), MP_ROM_PTR(&synthio_voice_stealing_type) },
     { MP_ROM_QSTR(MP_QSTR_LFO), MP_ROM_PTR(&synthio_lfo_type) },
     { MP_ROM_QSTR(MP_QSTR_Synthesizer), MP_ROM_PTR(&synthio_synthesizer_type) },
     { MP_ROM_QSTR(MP_QSTR_from_file), MP_ROM_PTR(&synthio_from_file_obj) },
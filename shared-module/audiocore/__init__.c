@@ -16,19 +16,97 @@
 #include "shared-bindings/audiomixer/Mixer.h"
 #include "shared-module/audiomixer/Mixer.h"
 
+// The sample currently filling a buffer, or NULL outside of any get_buffer
+static const audiosample_base_t *audiosample_pull_consumer;
+// Incremented each time a buffer is pulled from outside of any get_buffer,
+// typically by an audio output
+static uint32_t audiosample_pull_round;
+static size_t audiosample_scratch_len;
+
 void audiosample_reset_buffer(mp_obj_t sample_obj, bool single_channel_output, uint8_t audio_channel) {
     const audiosample_p_t *proto = mp_proto_get_or_throw(MP_QSTR_protocol_audiosample, sample_obj);
+    audiosample_base_t *sample = MP_OBJ_TO_PTR(sample_obj);
+    sample->pull_buffer = NULL;
     proto->reset_buffer(MP_OBJ_TO_PTR(sample_obj), single_channel_output, audio_channel);
 }
 
+static audioio_get_buffer_result_t audiosample_pull(const audiosample_p_t *proto, audiosample_base_t *sample,
+    bool single_channel_output, uint8_t channel,
+    uint8_t **buffer, uint32_t *buffer_length) {
+    const audiosample_base_t *consumer = audiosample_pull_consumer;
+    audiosample_pull_consumer = sample;
+    audioio_get_buffer_result_t result = proto->get_buffer(sample, single_channel_output, channel, buffer, buffer_length);
+    audiosample_pull_consumer = consumer;
+
+    sample->pull_single_channel_output = single_channel_output;
+    sample->pull_channel = channel;
+    sample->pull_result = result;
+    sample->pull_round = audiosample_pull_round;
+    sample->pull_buffer_length = *buffer_length;
+    sample->pull_buffer = *buffer;
+    sample->pull_consumer = consumer;
+    return result;
+}
+
+// Samples form a graph that is evaluated by pulling buffers from the output
+// end, so each sample is filled after the ones it depends on. When one sample
+// feeds several others (e.g., a synthesizer playing through both an Echo and a
+// Filter), the first of them to pull it during a round gets a new buffer, and
+// the rest get that same buffer instead of taking the following one. This
+// works best when all of them use the same buffer size.
 audioio_get_buffer_result_t audiosample_get_buffer(mp_obj_t sample_obj,
     bool single_channel_output,
     uint8_t channel,
     uint8_t **buffer, uint32_t *buffer_length) {
     const audiosample_p_t *proto = mp_proto_get_or_throw(MP_QSTR_protocol_audiosample, sample_obj);
-    return proto->get_buffer(MP_OBJ_TO_PTR(sample_obj), single_channel_output, channel, buffer, buffer_length);
+    audiosample_base_t *sample = MP_OBJ_TO_PTR(sample_obj);
+
+    if (audiosample_pull_consumer == NULL) {
+        audiosample_pull_round++;
+        audioio_get_buffer_result_t result;
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            result = audiosample_pull(proto, sample, single_channel_output, channel, buffer, buffer_length);
+            nlr_pop();
+        } else {
+            audiosample_pull_consumer = NULL;
+            nlr_jump(nlr.ret_val);
+        }
+        return result;
+    }
+
+    if (sample->pull_buffer != NULL
+        && sample->pull_round == audiosample_pull_round
+        && sample->pull_consumer != audiosample_pull_consumer
+        && sample->pull_single_channel_output == single_channel_output
+        && sample->pull_channel == channel) {
+        *buffer = sample->pull_buffer;
+        *buffer_length = sample->pull_buffer_length;
+        return sample->pull_result;
+    }
+
+    return audiosample_pull(proto, sample, single_channel_output, channel, buffer, buffer_length);
 }
 
+void audiosample_scratch_reserve(size_t len) {
+    if (len > audiosample_scratch_len) {
+        MP_STATE_VM(audiosample_scratch) = m_malloc_without_collect(len);
+        audiosample_scratch_len = len;
+    }
+}
+
+void *audiosample_scratch(void) {
+    return MP_STATE_VM(audiosample_scratch);
+}
+
+void audiocore_reset(void) {
+    MP_STATE_VM(audiosample_scratch) = NULL;
+    audiosample_scratch_len = 0;
+    audiosample_pull_consumer = NULL;
+}
+
+MP_REGISTER_ROOT_POINTER(void *audiosample_scratch);
+
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes) {
     for (; nframes--;) {
         int16_t sample = (*buffer_in++ - 0x80) << 8;
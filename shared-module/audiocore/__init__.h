@@ -26,6 +26,15 @@ typedef struct audiosample_base {
     uint8_t channel_count;
     uint8_t samples_signed;
     bool single_buffer;
+    // The last buffer this sample produced, which is handed to any other
+    // sample that pulls this one during the same round. See audiosample_get_buffer.
+    bool pull_single_channel_output;
+    uint8_t pull_channel;
+    audioio_get_buffer_result_t pull_result;
+    uint32_t pull_round;
+    uint32_t pull_buffer_length;
+    uint8_t *pull_buffer;
+    const struct audiosample_base *pull_consumer;
 } audiosample_base_t;
 
 typedef void (*audiosample_reset_buffer_fun)(mp_obj_t,
@@ -89,6 +98,15 @@ static inline void audiosample_get_buffer_structure_checked(mp_obj_t self_in, bo
     audiosample_get_buffer_structure(audiosample_check(self_in), single_channel_output, single_buffer, samples_signed, max_buffer_length, spacing);
 }
 
+// Scratch space shared by all samples, for data that is only needed while a
+// sample fills one of its buffers. It is not preserved across a call to
+// audiosample_get_buffer, because the sample being pulled may use it too.
+// Reserve the space when the sample is constructed, never while filling a buffer.
+void audiosample_scratch_reserve(size_t len);
+void *audiosample_scratch(void);
+
+void audiocore_reset(void);
+
 void audiosample_must_match(audiosample_base_t *self, mp_obj_t other, bool allow_mono_to_stereo);
 
 void audiosample_convert_u8m_s16s(int16_t *buffer_out, const uint8_t *buffer_in, size_t nframes);
@@ -39,9 +39,8 @@ void common_hal_audiofilters_filter_construct(audiofilters_filter_obj_t *self,
 
     self->last_buf_idx = 1; // Which buffer to use first, toggle between 0 and 1
 
-    // This buffer will be used to process samples through the biquad filter
-    self->filter_buffer = m_malloc_without_collect(SYNTHIO_MAX_DUR * sizeof(int32_t));
-    memset(self->filter_buffer, 0, SYNTHIO_MAX_DUR * sizeof(int32_t));
+    // Samples are processed through the biquad filter in scratch space shared with other effects
+    audiosample_scratch_reserve(SYNTHIO_MAX_DUR * sizeof(int32_t));
 
     // Initialize other values most effects will need.
     self->sample = NULL; // The current playing sample
@@ -62,7 +61,6 @@ void common_hal_audiofilters_filter_deinit(audiofilters_filter_obj_t *self) {
     self->buffer[0] = NULL;
     self->buffer[1] = NULL;
     self->filter = mp_const_none;
-    self->filter_buffer = NULL;
     self->filter_states = NULL;
 }
 
@@ -129,7 +127,6 @@ void audiofilters_filter_reset_buffer(audiofilters_filter_obj_t *self,
 
     memset(self->buffer[0], 0, self->buffer_len);
     memset(self->buffer[1], 0, self->buffer_len);
-    memset(self->filter_buffer, 0, SYNTHIO_MAX_DUR * sizeof(int32_t));
 
     if (self->filter_states) {
         for (uint8_t i = 0; i < self->filter_states_len; i++) {
@@ -246,6 +243,7 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
                     }
                 }
             } else {
+                int32_t *filter_buffer = audiosample_scratch();
                 uint32_t i = 0;
                 while (i < n) {
                     uint32_t n_samples = MIN(SYNTHIO_MAX_DUR, n - i);
@@ -253,13 +251,13 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
                     // Fill filter buffer with samples
                     for (uint32_t j = 0; j < n_samples; j++) {
                         if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                            self->filter_buffer[j] = sample_src[i + j];
+                            filter_buffer[j] = sample_src[i + j];
                         } else {
                             if (self->base.samples_signed) {
-                                self->filter_buffer[j] = sample_hsrc[i + j];
+                                filter_buffer[j] = sample_hsrc[i + j];
                             } else {
                                 // Be careful here changing from an 8 bit unsigned to signed into a 32-bit signed
-                                self->filter_buffer[j] = (int8_t)(((uint8_t)sample_hsrc[i + j]) ^ 0x80);
+                                filter_buffer[j] = (int8_t)(((uint8_t)sample_hsrc[i + j]) ^ 0x80);
                             }
                         }
                     }
@@ -268,21 +266,21 @@ audioio_get_buffer_result_t audiofilters_filter_get_buffer(audiofilters_filter_o
                     for (uint8_t j = 0; j < self->filter_states_len; j++) {
                         mp_obj_t filter_obj = self->filter_objs[j];
                         common_hal_synthio_biquad_tick(filter_obj);
-                        synthio_biquad_filter_samples(filter_obj, &self->filter_states[j], self->filter_buffer, n_samples);
+                        synthio_biquad_filter_samples(filter_obj, &self->filter_states[j], filter_buffer, n_samples);
                     }
 
                     // Mix processed signal with original sample and transfer to output buffer
                     for (uint32_t j = 0; j < n_samples; j++) {
                         if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                            word_buffer[i + j] = synthio_mix_down_sample((int32_t)((sample_src[i + j] * (MICROPY_FLOAT_CONST(1.0) - mix)) + (self->filter_buffer[j] * mix)), SYNTHIO_MIX_DOWN_SCALE(2));
+                            word_buffer[i + j] = synthio_mix_down_sample((int32_t)((sample_src[i + j] * (MICROPY_FLOAT_CONST(1.0) - mix)) + (filter_buffer[j] * mix)), SYNTHIO_MIX_DOWN_SCALE(2));
                             if (!self->base.samples_signed) {
                                 word_buffer[i + j] ^= 0x8000;
                             }
                         } else {
                             if (self->base.samples_signed) {
-                                hword_buffer[i + j] = (int8_t)((sample_hsrc[i + j] * (MICROPY_FLOAT_CONST(1.0) - mix)) + (self->filter_buffer[j] * mix));
+                                hword_buffer[i + j] = (int8_t)((sample_hsrc[i + j] * (MICROPY_FLOAT_CONST(1.0) - mix)) + (filter_buffer[j] * mix));
                             } else {
-                                hword_buffer[i + j] = (uint8_t)(((int8_t)(((uint8_t)sample_hsrc[i + j]) ^ 0x80) * (MICROPY_FLOAT_CONST(1.0) - mix)) + (self->filter_buffer[j] * mix)) ^ 0x80;
+                                hword_buffer[i + j] = (uint8_t)(((int8_t)(((uint8_t)sample_hsrc[i + j]) ^ 0x80) * (MICROPY_FLOAT_CONST(1.0) - mix)) + (filter_buffer[j] * mix)) ^ 0x80;
                             }
                         }
                     }
@@ -31,8 +31,6 @@ typedef struct {
     uint8_t *sample_remaining_buffer;
     uint32_t sample_buffer_length;
 
-    int32_t *filter_buffer;
-
     bool loop;
     bool more_data;
 
@@ -75,51 +75,36 @@ static inline uint32_t add16signed(uint32_t a, uint32_t b) {
     #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
     return __QADD16(a, b);
     #else
-    uint32_t result = 0;
-    for (int8_t i = 0; i < 2; i++) {
-        int16_t ai = a >> (sizeof(int16_t) * 8 * i);
-        int16_t bi = b >> (sizeof(int16_t) * 8 * i);
-        int32_t intermediate = (int32_t)ai + bi;
-        if (intermediate > SHRT_MAX) {
-            intermediate = SHRT_MAX;
-        } else if (intermediate < SHRT_MIN) {
-            intermediate = SHRT_MIN;
-        }
-        result |= (((uint32_t)intermediate) & 0xffff) << (sizeof(int16_t) * 8 * i);
-    }
-    return result;
+    int32_t lo = (int16_t)a + (int16_t)b;
+    int32_t hi = (int16_t)(a >> 16) + (int16_t)(b >> 16);
+    lo = MIN(MAX(lo, SHRT_MIN), SHRT_MAX);
+    hi = MIN(MAX(hi, SHRT_MIN), SHRT_MAX);
+    return ((uint32_t)lo & 0xffff) | ((uint32_t)hi << 16);
     #endif
 }
 
+// Scale each half of val by mul / 32768. mul[0] and mul[1] must be in the
+// range 0 to 32768, so the results always fit and 32768 passes val unchanged.
 __attribute__((always_inline))
-static inline uint32_t mult16signed(uint32_t val, int32_t mul[2]) {
+static inline uint32_t mult16signed(uint32_t val, const int32_t mul[2]) {
     #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
-    mul[0] <<= 16;
-    mul[1] <<= 16;
+    // smulw* drops the low 16 bits of the product, so pre-shift mul by 15 and
+    // shift the rest out afterwards. Rounds exactly like the portable version.
+    int32_t mul_lo = mul[0] << 15;
+    int32_t mul_hi = mul[1] << 15;
     int32_t hi, lo;
     enum { bits = 16 }; // saturate to 16 bits
-    enum { shift = 15 }; // shift is done automatically
-    asm volatile ("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul[0]), "r" (val));
-    asm volatile ("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul[1]), "r" (val));
+    enum { shift = 14 }; // the other bit is shifted by smulw*
+    asm volatile ("smulwb %0, %1, %2" : "=r" (lo) : "r" (mul_lo), "r" (val));
+    asm volatile ("smulwt %0, %1, %2" : "=r" (hi) : "r" (mul_hi), "r" (val));
     asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (lo) : "I" (bits), "r" (lo), "I" (shift));
     asm volatile ("ssat %0, %1, %2, asr %3" : "=r" (hi) : "I" (bits), "r" (hi), "I" (shift));
     asm volatile ("pkhbt %0, %1, %2, lsl #16" : "=r" (val) : "r" (lo), "r" (hi)); // pack
     return val;
     #else
-    uint32_t result = 0;
-    for (int8_t i = 0; i < 2; i++) {
-        float mod_mul = (float)mul[i] / (float)((1 << 15) - 1);
-        int16_t ai = (val >> (sizeof(uint16_t) * 8 * i));
-        int32_t intermediate = (int32_t)(ai * mod_mul);
-        if (intermediate > SHRT_MAX) {
-            intermediate = SHRT_MAX;
-        } else if (intermediate < SHRT_MIN) {
-            intermediate = SHRT_MIN;
-        }
-        intermediate &= 0x0000FFFF;
-        result |= (((uint32_t)intermediate)) << (sizeof(int16_t) * 8 * i);
-    }
-    return result;
+    int32_t lo = ((int16_t)val * mul[0]) >> 15;
+    int32_t hi = ((int16_t)(val >> 16) * mul[1]) >> 15;
+    return ((uint32_t)lo & 0xffff) | ((uint32_t)hi << 16);
     #endif
 }
 
@@ -165,15 +150,107 @@ static inline uint32_t copy16msb(uint32_t val) {
     return val | (val >> 16);
 }
 
-static inline uint32_t copy8lsb(uint32_t val) {
-    val &= 0x00ff;
-    return val | (val << 8);
+// Mix n words of a voice into word_buffer, scaled by loudness. The first
+// voice is stored rather than added. Each combination of the parameters after
+// loudness gets its own copy of this loop (see mix_kernels below), so that
+// none of them are tested inside it.
+#if CIRCUITPY_OPT_AUDIOMIXER_KERNELS
+__attribute__((always_inline)) inline
+#endif
+static void mix_kernel(uint32_t *restrict word_buffer, const uint32_t *restrict src, uint32_t n, const int32_t loudness[2],
+    bool bits_16, bool samples_signed, bool mono_to_stereo, bool first_voice) {
+    if (bits_16) {
+        if (!mono_to_stereo) {
+            for (uint32_t i = 0; i < n; i++) {
+                uint32_t word = src[i];
+                if (!samples_signed) {
+                    word = tosigned16(word);
+                }
+                word = mult16signed(word, loudness);
+                word_buffer[i] = first_voice ? word : add16signed(word, word_buffer[i]);
+            }
+        } else {
+            for (uint32_t i = 0; i + 1 < n; i += 2) {
+                uint32_t word = src[i >> 1];
+                if (!samples_signed) {
+                    word = tosigned16(word);
+                }
+                uint32_t left = mult16signed(copy16lsb(word), loudness);
+                uint32_t right = mult16signed(copy16msb(word), loudness);
+                word_buffer[i] = first_voice ? left : add16signed(left, word_buffer[i]);
+                word_buffer[i + 1] = first_voice ? right : add16signed(right, word_buffer[i + 1]);
+            }
+        }
+    } else {
+        uint16_t *hword_buffer = (uint16_t *)word_buffer;
+        const uint16_t *hsrc = (const uint16_t *)src;
+        if (!mono_to_stereo) {
+            for (uint32_t i = 0; i < n * 2; i++) {
+                uint32_t word = unpack8(hsrc[i]);
+                if (!samples_signed) {
+                    word = tosigned16(word);
+                }
+                word = mult16signed(word, loudness);
+                if (!first_voice) {
+                    word = add16signed(word, unpack8(hword_buffer[i]));
+                }
+                hword_buffer[i] = pack8(word);
+            }
+        } else {
+            for (uint32_t i = 0; i + 1 < n * 2; i += 2) {
+                uint32_t word = unpack8(hsrc[i >> 1]);
+                if (!samples_signed) {
+                    word = tosigned16(word);
+                }
+                uint32_t left = mult16signed(copy16lsb(word), loudness);
+                uint32_t right = mult16signed(copy16msb(word), loudness);
+                if (!first_voice) {
+                    left = add16signed(left, unpack8(hword_buffer[i]));
+                    right = add16signed(right, unpack8(hword_buffer[i + 1]));
+                }
+                hword_buffer[i] = pack8(left);
+                hword_buffer[i + 1] = pack8(right);
+            }
+        }
+    }
 }
 
-static inline uint32_t copy8msb(uint32_t val) {
-    val &= 0xff00;
-    return val | (val >> 8);
-}
+typedef void (*mix_kernel_fun)(uint32_t *word_buffer, const uint32_t *src, uint32_t n, const int32_t loudness[2]);
+
+#define MIX_KERNEL(bits_16, samples_signed, mono_to_stereo, first_voice) \
+    static void mix_kernel_##bits_16##samples_signed##mono_to_stereo##first_voice( \
+    uint32_t *word_buffer, const uint32_t *src, uint32_t n, const int32_t loudness[2]) { \
+        mix_kernel(word_buffer, src, n, loudness, bits_16, samples_signed, mono_to_stereo, first_voice); \
+    }
+
+MIX_KERNEL(0, 0, 0, 0)
+MIX_KERNEL(0, 0, 0, 1)
+MIX_KERNEL(0, 0, 1, 0)
+MIX_KERNEL(0, 0, 1, 1)
+MIX_KERNEL(0, 1, 0, 0)
+MIX_KERNEL(0, 1, 0, 1)
+MIX_KERNEL(0, 1, 1, 0)
+MIX_KERNEL(0, 1, 1, 1)
+MIX_KERNEL(1, 0, 0, 0)
+MIX_KERNEL(1, 0, 0, 1)
+MIX_KERNEL(1, 0, 1, 0)
+MIX_KERNEL(1, 0, 1, 1)
+MIX_KERNEL(1, 1, 0, 0)
+MIX_KERNEL(1, 1, 0, 1)
+MIX_KERNEL(1, 1, 1, 0)
+MIX_KERNEL(1, 1, 1, 1)
+
+// indexed by [bits_per_sample == 16][samples_signed][mono_to_stereo][first_voice]
+static const mix_kernel_fun mix_kernels[2][2][2][2] = {
+    {
+        { { mix_kernel_0000, mix_kernel_0001 }, { mix_kernel_0010, mix_kernel_0011 } },
+        { { mix_kernel_0100, mix_kernel_0101 }, { mix_kernel_0110, mix_kernel_0111 } },
+    },
+    {
+        { { mix_kernel_1000, mix_kernel_1001 }, { mix_kernel_1010, mix_kernel_1011 } },
+        { { mix_kernel_1100, mix_kernel_1101 }, { mix_kernel_1110, mix_kernel_1111 } },
+    },
+};
 
 #define ALMOST_ONE (MICROPY_FLOAT_CONST(32767.) / 32768)
 
@@ -181,6 +258,8 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
     audiomixer_mixervoice_obj_t *voice, bool voices_active,
     uint32_t *word_buffer, uint32_t length) {
     audiosample_base_t *sample = MP_OBJ_TO_PTR(voice->sample);
+    bool mono_to_stereo = self->base.channel_count != sample->channel_count;
+    const mix_kernel_fun *kernels = mix_kernels[self->base.bits_per_sample == 16][self->base.samples_signed][mono_to_stereo];
     while (length != 0) {
         if (voice->buffer_length == 0) {
             if (!voice->more_data) {
@@ -204,7 +283,7 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
 
         #if CIRCUITPY_SYNTHIO
         uint32_t n;
-        if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
+        if (MP_LIKELY(!mono_to_stereo)) {
             n = MIN(MIN(voice->buffer_length, length), SYNTHIO_MAX_DUR * self->base.channel_count);
         } else {
             n = MIN(MIN(voice->buffer_length << 1, length), SYNTHIO_MAX_DUR * self->base.channel_count);
@@ -216,7 +295,7 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
         int16_t panning = synthio_block_slot_get_scaled(&voice->panning, -ALMOST_ONE, ALMOST_ONE);
         #else
         uint32_t n;
-        if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
+        if (MP_LIKELY(!mono_to_stereo)) {
             n = MIN(voice->buffer_length, length);
         } else {
             n = MIN(voice->buffer_length << 1, length);
@@ -227,9 +306,9 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
 
         uint16_t left_panning_scaled = 32768, right_panning_scaled = 32768;
         if (MP_LIKELY(self->base.channel_count == 2)) {
-            if (panning >= 0) {
+            if (panning > 0) {
                 right_panning_scaled = 32767 - panning;
-            } else {
+            } else if (panning < 0) {
                 left_panning_scaled = 32767 + panning;
             }
         }
@@ -241,119 +320,11 @@ static void mix_down_one_voice(audiomixer_mixer_obj_t *self,
         }
 
         // First active voice gets copied over verbatim.
-        if (!voices_active) {
-            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                if (MP_LIKELY(self->base.samples_signed)) {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t v = src[i];
-                            word_buffer[i] = mult16signed(v, loudness);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i < n; i += 2) {
-                            uint32_t v = src[i >> 1];
-                            word_buffer[i] = mult16signed(copy16lsb(v), loudness);
-                            word_buffer[i + 1] = mult16signed(copy16msb(v), loudness);
-                        }
-                    }
-                } else {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t v = src[i];
-                            v = tosigned16(v);
-                            word_buffer[i] = mult16signed(v, loudness);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i + 1 < n; i += 2) {
-                            uint32_t v = src[i >> 1];
-                            v = tosigned16(v);
-                            word_buffer[i] = mult16signed(copy16lsb(v), loudness);
-                            word_buffer[i + 1] = mult16signed(copy16msb(v), loudness);
-                        }
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                    for (uint32_t i = 0; i < n * 2; i++) {
-                        uint32_t word = unpack8(hsrc[i]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        word = mult16signed(word, loudness);
-                        hword_buffer[i] = pack8(word);
-                    }
-                } else {
-                    for (uint32_t i = 0; i + 1 < n * 2; i += 2) {
-                        uint32_t word = unpack8(hsrc[i >> 1]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        hword_buffer[i] = pack8(mult16signed(copy16lsb(word), loudness));
-                        hword_buffer[i + 1] = pack8(mult16signed(copy16msb(word), loudness));
-                    }
-                }
-            }
-        } else {
-            if (MP_LIKELY(self->base.bits_per_sample == 16)) {
-                if (MP_LIKELY(self->base.samples_signed)) {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t word = src[i];
-                            word_buffer[i] = add16signed(mult16signed(word, loudness), word_buffer[i]);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i + 1 < n; i += 2) {
-                            uint32_t word = src[i >> 1];
-                            word_buffer[i] = add16signed(mult16signed(copy16lsb(word), loudness), word_buffer[i]);
-                            word_buffer[i + 1] = add16signed(mult16signed(copy16msb(word), loudness), word_buffer[i + 1]);
-                        }
-                    }
-                } else {
-                    if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                        for (uint32_t i = 0; i < n; i++) {
-                            uint32_t word = src[i];
-                            word = tosigned16(word);
-                            word_buffer[i] = add16signed(mult16signed(word, loudness), word_buffer[i]);
-                        }
-                    } else {
-                        for (uint32_t i = 0; i + 1 < n; i += 2) {
-                            uint32_t word = src[i >> 1];
-                            word = tosigned16(word);
-                            word_buffer[i] = add16signed(mult16signed(copy16lsb(word), loudness), word_buffer[i]);
-                            word_buffer[i + 1] = add16signed(mult16signed(copy16msb(word), loudness), word_buffer[i + 1]);
-                        }
-                    }
-                }
-            } else {
-                uint16_t *hword_buffer = (uint16_t *)word_buffer;
-                uint16_t *hsrc = (uint16_t *)src;
-                if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
-                    for (uint32_t i = 0; i < n * 2; i++) {
-                        uint32_t word = unpack8(hsrc[i]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        word = mult16signed(word, loudness);
-                        word = add16signed(word, unpack8(hword_buffer[i]));
-                        hword_buffer[i] = pack8(word);
-                    }
-                } else {
-                    for (uint32_t i = 0; i + 1 < n * 2; i += 2) {
-                        uint32_t word = unpack8(hsrc[i >> 1]);
-                        if (MP_LIKELY(!self->base.samples_signed)) {
-                            word = tosigned16(word);
-                        }
-                        hword_buffer[i] = pack8(add16signed(mult16signed(copy16lsb(word), loudness), unpack8(hword_buffer[i])));
-                        hword_buffer[i + 1] = pack8(add16signed(mult16signed(copy16msb(word), loudness), unpack8(hword_buffer[i + 1])));
-                    }
-                }
-            }
-        }
+        kernels[!voices_active](word_buffer, src, n, loudness);
+
         length -= n;
         word_buffer += n;
-        if (MP_LIKELY(self->base.channel_count == sample->channel_count)) {
+        if (MP_LIKELY(!mono_to_stereo)) {
             voice->remaining_buffer += n;
             voice->buffer_length -= n;
         } else {
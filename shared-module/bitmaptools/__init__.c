@@ -10,6 +10,7 @@
 #include "shared-bindings/displayio/Palette.h"
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-module/displayio/Bitmap.h"
+#include "shared-module/displayio/polygon.h"
 
 #include "py/mperrno.h"
 #include "py/runtime.h"
@@ -23,6 +24,96 @@
 #define BITMAP_DEBUG(...) (void)0
 // #define BITMAP_DEBUG(...) mp_printf(&mp_plat_print, __VA_ARGS__)
 
+// Converts to 16.16 fixed point. Clamped well within int64_t so that row math can't overflow.
+static int64_t rotozoom_fixed(mp_float_t value) {
+    const mp_float_t limit = MICROPY_FLOAT_CONST(140737488355328.0); // 2 ** 47
+    value *= 65536;
+    if (!(value > -limit)) {
+        return -((int64_t)1 << 47);
+    }
+    if (value > limit) {
+        return (int64_t)1 << 47;
+    }
+    return (int64_t)MICROPY_FLOAT_C_FUN(floor)(value + MICROPY_FLOAT_CONST(0.5));
+}
+
+// Division that rounds toward negative infinity. b must be positive.
+static int64_t floor_div(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    if (a % b != 0 && a < 0) {
+        q--;
+    }
+    return q;
+}
+
+// Narrows the steps first through last to those where start + step * n is inside the 16.16
+// fixed point version of [lo, hi).
+static void rotozoom_clip_span(int64_t start, int64_t step, int16_t lo, int16_t hi, int32_t *first, int32_t *last) {
+    int64_t fixed_lo = (int64_t)lo << 16;
+    int64_t fixed_hi = ((int64_t)hi << 16) - 1;
+    if (step == 0) {
+        if (start < fixed_lo || start > fixed_hi) {
+            *last = *first - 1;
+        }
+        return;
+    }
+    int64_t n_first, n_last;
+    if (step > 0) {
+        n_first = -floor_div(start - fixed_lo, step);
+        n_last = floor_div(fixed_hi - start, step);
+    } else {
+        n_first = -floor_div(fixed_hi - start, -step);
+        n_last = floor_div(start - fixed_lo, -step);
+    }
+    if (n_first > *first) {
+        *first = MIN(n_first, INT32_MAX);
+    }
+    if (n_last < *last) {
+        *last = MAX(n_last, INT32_MIN + 1);
+    }
+}
+
+// Spreads RGB565 out so that each channel has room to be multiplied by a 5 bit weight.
+static uint32_t rgb565_spread(uint32_t c) {
+    return (c | (c << 16)) & 0x07e0f81f;
+}
+
+// Blends spread colors a and b with b weighted by w out of 32.
+static uint32_t rgb565_spread_lerp(uint32_t a, uint32_t b, uint32_t w) {
+    return ((a * (32 - w) + b * w) >> 5) & 0x07e0f81f;
+}
+
+// Blends the four RGB565 source pixels around the 16.16 fixed point u, v. Neighbors past the
+// clip window or equal to skip_index are replaced by the nearest pixel. Returns false if the
+// nearest pixel is skipped.
+static bool rotozoom_bilinear(displayio_bitmap_t *source, uint32_t u, uint32_t v,
+    int16_t clip1_x, int16_t clip1_y, uint32_t skip_index, bool skip_index_none, uint32_t *color) {
+    uint32_t x0 = u >> 16;
+    uint32_t y0 = v >> 16;
+    uint32_t x1 = x0 + 1 < (uint32_t)clip1_x ? x0 + 1 : x0;
+    const uint16_t *row0 = (const uint16_t *)(source->data + y0 * source->stride);
+    const uint16_t *row1 = y0 + 1 < (uint32_t)clip1_y ? row0 + source->stride * 2 : row0;
+    uint32_t p00 = row0[x0];
+    if (!skip_index_none && p00 == skip_index) {
+        return false;
+    }
+    uint32_t p10 = row0[x1];
+    uint32_t p01 = row1[x0];
+    uint32_t p11 = row1[x1];
+    if (!skip_index_none) {
+        p10 = p10 == skip_index ? p00 : p10;
+        p01 = p01 == skip_index ? p00 : p01;
+        p11 = p11 == skip_index ? p00 : p11;
+    }
+    uint32_t wx = (u >> 11) & 0x1f;
+    uint32_t wy = (v >> 11) & 0x1f;
+    uint32_t top = rgb565_spread_lerp(rgb565_spread(p00), rgb565_spread(p10), wx);
+    uint32_t bottom = rgb565_spread_lerp(rgb565_spread(p01), rgb565_spread(p11), wx);
+    uint32_t c = rgb565_spread_lerp(top, bottom, wy);
+    *color = (c | (c >> 16)) & 0xffff;
+    return true;
+}
+
 void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16_t oy,
     int16_t dest_clip0_x, int16_t dest_clip0_y,
     int16_t dest_clip1_x, int16_t dest_clip1_y,
@@ -31,8 +122,11 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     int16_t source_clip1_x, int16_t source_clip1_y,
     mp_float_t angle,
     mp_float_t scale,
-    uint32_t skip_index, bool skip_index_none) {
+    uint32_t skip_index, bool skip_index_none, bool bilinear) {
 
+    if (self->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
     // Copies region from source to the destination bitmap, including rotation,
     // scaling and clipping of either the source or destination regions
     //
@@ -51,6 +145,7 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     // skip_index: color index that should be ignored (and not copied over)
     // skip_index_none: if skip_index_none is True, then all color indexes should be copied
     //                                                     (that is, no color indexes should be skipped)
+    // bilinear: blend the four nearest RGB565 source pixels when both bitmaps are 16 bits per value
 
 
     // Copy complete "source" bitmap into "self" bitmap at location x,y in the "self"
@@ -180,27 +275,68 @@ void common_hal_bitmaptools_rotozoom(displayio_bitmap_t *self, int16_t ox, int16
     mp_float_t startu = px - (ox * dvCol + oy * duCol);
     mp_float_t startv = py - (ox * dvRow + oy * duRow);
 
-    mp_float_t rowu = startu + miny * duCol;
-    mp_float_t rowv = startv + miny * dvCol;
-
     displayio_area_t dirty_area = {minx, miny, maxx + 1, maxy + 1, NULL};
     displayio_bitmap_set_dirty_area(self, &dirty_area);
 
-    for (y = miny; y <= maxy; y++) {
-        mp_float_t u = rowu + minx * duRow;
-        mp_float_t v = rowv + minx * dvRow;
-        for (x = minx; x <= maxx; x++) {
-            if (u >= source_clip0_x && u < source_clip1_x && v >= source_clip0_y && v < source_clip1_y) {
-                uint32_t c = common_hal_displayio_bitmap_get_pixel(source, (int)u, (int)v);
-                if ((skip_index_none) || (c != skip_index)) {
-                    displayio_bitmap_write_pixel(self, x, y, c);
+    if (scale == 0) {
+        return;
+    }
+
+    // Step through the source in 16.16 fixed point so that no per pixel work needs floats.
+    int64_t du_col = rotozoom_fixed(duCol);
+    int64_t dv_col = rotozoom_fixed(dvCol);
+    int64_t du_row = rotozoom_fixed(duRow);
+    int64_t dv_row = rotozoom_fixed(dvRow);
+    int64_t row_u = rotozoom_fixed(startu) + miny * du_col + minx * du_row;
+    int64_t row_v = rotozoom_fixed(startv) + miny * dv_col + minx * dv_row;
+
+    bilinear = bilinear && source->bits_per_value == 16 && self->bits_per_value == 16;
+
+    for (y = miny; y <= maxy; y++, row_u += du_col, row_v += dv_col) {
+        // Only visit the pixels of this row that land inside the source clip window.
+        int32_t first = 0;
+        int32_t last = maxx - minx;
+        rotozoom_clip_span(row_u, du_row, source_clip0_x, source_clip1_x, &first, &last);
+        rotozoom_clip_span(row_v, dv_row, source_clip0_y, source_clip1_y, &first, &last);
+        if (first > last) {
+            continue;
+        }
+        // Values in the span are within the source so they fit unsigned 32 bit math.
+        uint32_t u = row_u + first * du_row;
+        uint32_t v = row_v + first * dv_row;
+        uint32_t du = du_row;
+        uint32_t dv = dv_row;
+        uint32_t *dest_row = self->data + y * self->stride;
+
+        if (bilinear) {
+            for (x = minx + first; x <= minx + last; x++, u += du, v += dv) {
+                uint32_t c;
+                if (rotozoom_bilinear(source, u, v, source_clip1_x, source_clip1_y, skip_index, skip_index_none, &c)) {
+                    ((uint16_t *)dest_row)[x] = c;
+                }
+            }
+        } else if (source->bits_per_value == 16 && self->bits_per_value == 16) {
+            for (x = minx + first; x <= minx + last; x++, u += du, v += dv) {
+                uint16_t c = ((const uint16_t *)(source->data + (v >> 16) * source->stride))[u >> 16];
+                if (skip_index_none || c != skip_index) {
+                    ((uint16_t *)dest_row)[x] = c;
+                }
+            }
+        } else if (source->bits_per_value == 8 && self->bits_per_value == 8) {
+            for (x = minx + first; x <= minx + last; x++, u += du, v += dv) {
+                uint8_t c = ((const uint8_t *)(source->data + (v >> 16) * source->stride))[u >> 16];
+                if (skip_index_none || c != skip_index) {
+                    ((uint8_t *)dest_row)[x] = c;
+                }
+            }
+        } else {
+            for (x = minx + first; x <= minx + last; x++, u += du, v += dv) {
+                uint32_t c = displayio_bitmap_get_pixel_in_row(source, source->data + (v >> 16) * source->stride, u >> 16);
+                if (skip_index_none || c != skip_index) {
+                    displayio_bitmap_set_pixel_in_row(self, dest_row, x, c);
                 }
             }
-            u += duRow;
-            v += dvRow;
         }
-        rowu += duCol;
-        rowv += dvCol;
     }
 }
 
@@ -528,6 +664,76 @@ void common_hal_bitmaptools_draw_polygon(displayio_bitmap_t *destination, void *
     displayio_bitmap_set_dirty_area(destination, &area);
 }
 
+// Writes value into the pixels [x1, x2) of a row.
+static void fill_span(displayio_bitmap_t *bitmap, uint32_t *row, int16_t x1, int16_t x2, uint32_t value) {
+    switch (bitmap->bits_per_value) {
+        case 32:
+            for (int16_t x = x1; x < x2; x++) {
+                row[x] = value;
+            }
+            break;
+        case 16:
+            for (int16_t x = x1; x < x2; x++) {
+                ((uint16_t *)row)[x] = value;
+            }
+            break;
+        case 8:
+            memset((uint8_t *)row + x1, value, x2 - x1);
+            break;
+        default:
+            for (int16_t x = x1; x < x2; x++) {
+                displayio_bitmap_set_pixel_in_row(bitmap, row, x, value);
+            }
+    }
+}
+
+void common_hal_bitmaptools_fill_polygon(displayio_bitmap_t *destination, void *xs, void *ys, size_t points_len, int point_size, uint32_t value) {
+    if (destination->read_only) {
+        mp_raise_RuntimeError(MP_ERROR_TEXT("Read-only"));
+    }
+    if (points_len < 3) {
+        return;
+    }
+    int16_t *points = m_new(int16_t, 2 * points_len);
+    int16_t xmin = INT16_MAX, ymin = INT16_MAX, xmax = INT16_MIN, ymax = INT16_MIN;
+    for (size_t i = 0; i < points_len; i++) {
+        int16_t x = ith(xs, i, point_size);
+        int16_t y = ith(ys, i, point_size);
+        points[2 * i] = x;
+        points[2 * i + 1] = y;
+        xmin = MIN(xmin, x);
+        xmax = MAX(xmax, x);
+        ymin = MIN(ymin, y);
+        ymax = MAX(ymax, y);
+    }
+    size_t buffer_size = displayio_polygon_buffer_size(points_len);
+    uint8_t *buffer = m_new(uint8_t, buffer_size);
+    displayio_polygon_t polygon;
+    displayio_polygon_init(&polygon, points, points_len, buffer);
+    m_del(int16_t, points, 2 * points_len);
+
+    displayio_area_t area = { xmin, ymin, xmax, ymax, NULL };
+    displayio_area_t bitmap_area = { 0, 0, destination->width, destination->height, NULL };
+    if (displayio_area_compute_overlap(&area, &bitmap_area, &area)) {
+        displayio_bitmap_set_dirty_area(destination, &area);
+        // Fill each row a span at a time. The last row and column only hold pixels on the edge,
+        // which are outside.
+        for (int16_t y = area.y1; y < area.y2; y++) {
+            const int16_t *spans;
+            uint16_t span_count = displayio_polygon_get_row_spans(&polygon, y, &spans);
+            uint32_t *row = destination->data + y * destination->stride;
+            for (uint16_t i = 0; i < span_count; i++) {
+                int16_t x1 = MAX(spans[2 * i], area.x1);
+                int16_t x2 = MIN(spans[2 * i + 1], area.x2);
+                if (x1 < x2) {
+                    fill_span(destination, row, x1, x2, value);
+                }
+            }
+        }
+    }
+    m_del(uint8_t, buffer, buffer_size);
+}
+
 void common_hal_bitmaptools_arrayblit(displayio_bitmap_t *self, void *data, int element_size, int x1, int y1, int x2, int y2, bool skip_specified, uint32_t skip_value) {
     uint32_t mask = (1 << common_hal_displayio_bitmap_get_bits_per_value(self)) - 1;
 
@@ -1034,6 +1240,55 @@ void common_hal_bitmaptools_draw_circle(displayio_bitmap_t *destination,
     draw_circle(destination, x, y, radius, value);
 }
 
+// Returns true when two bitmap rows share any memory, such as when a bitmap is blitted onto
+// itself.
+static bool rows_overlap(const uint32_t *a, const uint32_t *b, uint16_t a_stride, uint16_t b_stride) {
+    return a < b + b_stride && b < a + a_stride;
+}
+
+// Copies count bits from src_bit of src to dst_bit of dst. Bits are numbered from the most
+// significant bit of each byte to match the order of sub-byte pixels.
+static void copy_bits(uint8_t *dst, uint32_t dst_bit, const uint8_t *src, uint32_t src_bit, uint32_t count) {
+    dst += dst_bit / 8;
+    dst_bit %= 8;
+    src += src_bit / 8;
+    src_bit %= 8;
+    if (src_bit == dst_bit) {
+        // Byte aligned so only the ends need masking.
+        if (dst_bit != 0) {
+            uint32_t bits = MIN(8 - dst_bit, count);
+            uint8_t mask = (0xff >> dst_bit) & ~(0xff >> (dst_bit + bits));
+            *dst = (*dst & ~mask) | (*src & mask);
+            dst++;
+            src++;
+            count -= bits;
+        }
+        memcpy(dst, src, count / 8);
+        if (count % 8 != 0) {
+            uint8_t mask = ~(0xff >> (count % 8));
+            dst[count / 8] = (dst[count / 8] & ~mask) | (src[count / 8] & mask);
+        }
+        return;
+    }
+    while (count > 0) {
+        // Shift the source bits for this destination byte out of a two byte window.
+        uint32_t bits = MIN(8 - dst_bit, count);
+        uint32_t window = src[0] << 8;
+        if (src_bit + bits > 8) {
+            window |= src[1];
+        }
+        uint8_t value = (((window << src_bit) >> 8) & 0xff) >> dst_bit;
+        uint8_t mask = (0xff >> dst_bit) & ~(0xff >> (dst_bit + bits));
+        *dst = (*dst & ~mask) | (value & mask);
+        dst++;
+        dst_bit = 0;
+        src_bit += bits;
+        src += src_bit / 8;
+        src_bit %= 8;
+        count -= bits;
+    }
+}
+
 void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitmap_t *source, int16_t x, int16_t y,
     int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint32_t skip_source_index, bool skip_source_index_none, uint32_t skip_dest_index,
     bool skip_dest_index_none) {
@@ -1059,45 +1314,71 @@ void common_hal_bitmaptools_blit(displayio_bitmap_t *destination, displayio_bitm
     displayio_area_t a = { x, y, dirty_x_max, dirty_y_max, NULL};
     displayio_bitmap_set_dirty_area(destination, &a);
 
-    bool x_reverse = false;
-    bool y_reverse = false;
-
-    // Add reverse direction option to protect blitting of destination bitmap back into destination bitmap
-    if (x > x1) {
-        x_reverse = true;
-    }
-    if (y > y1) {
-        y_reverse = true;
+    // Clip the copy to both bitmaps once so the row loops don't need to check every pixel.
+    int32_t dx = x - x1;
+    int32_t dy = y - y1;
+    int32_t src_x1 = MAX(MAX(x1, 0), -dx);
+    int32_t src_y1 = MAX(MAX(y1, 0), -dy);
+    int32_t src_x2 = MIN(MIN(x2, source->width), destination->width - dx);
+    int32_t src_y2 = MIN(MIN(y2, source->height), destination->height - dy);
+    if (src_x1 >= src_x2 || src_y1 >= src_y2) {
+        return;
     }
+    uint16_t width = src_x2 - src_x1;
+
+    // Copy in the direction that protects blitting of destination bitmap back into destination bitmap.
+    bool x_reverse = dx > 0;
+    bool y_reverse = dy > 0;
+    bool same_depth = source->bits_per_value == destination->bits_per_value;
+    uint8_t bytes_per_value = source->bits_per_value / 8;
+
+    for (int32_t j = 0; j < src_y2 - src_y1; j++) {
+        int32_t ys = y_reverse ? src_y2 - j - 1 : src_y1 + j;
+        const uint32_t *source_row = source->data + ys * source->stride;
+        uint32_t *dest_row = destination->data + (ys + dy) * destination->stride;
+
+        if (same_depth && skip_source_index_none && skip_dest_index_none) {
+            if (bytes_per_value > 0) {
+                // memmove handles a row blitted back onto itself.
+                memmove((uint8_t *)dest_row + (src_x1 + dx) * bytes_per_value,
+                    (const uint8_t *)source_row + src_x1 * bytes_per_value, width * bytes_per_value);
+                continue;
+            }
+            if (!rows_overlap(source_row, dest_row, source->stride, destination->stride)) {
+                copy_bits((uint8_t *)dest_row, (src_x1 + dx) * source->bits_per_value,
+                    (const uint8_t *)source_row, src_x1 * source->bits_per_value, width * source->bits_per_value);
+                continue;
+            }
+        }
 
-    // simplest version - use internal functions for get/set pixels
-    for (int16_t i = 0; i < (x2 - x1); i++) {
-
-        const int xs_index = x_reverse ? ((x2) - i - 1) : x1 + i; // x-index into the source bitmap
-        const int xd_index = x_reverse ? ((x + (x2 - x1)) - i - 1) : x + i; // x-index into the destination bitmap
-
-        if ((xd_index >= 0) && (xd_index < destination->width)) {
-            for (int16_t j = 0; j < (y2 - y1); j++) {
-
-                const int ys_index = y_reverse ? ((y2) - j - 1) : y1 + j;  // y-index into the source bitmap
-                const int yd_index = y_reverse ? ((y + (y2 - y1)) - j - 1) : y + j; // y-index into the destination bitmap
-
-                if ((yd_index >= 0) && (yd_index < destination->height)) {
-                    uint32_t value = common_hal_displayio_bitmap_get_pixel(source, xs_index, ys_index);
-                    if (skip_dest_index_none) { // if skip_dest_index is none, then only check source skip
-                        if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                            displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                        }
-                    } else { // check dest_value index against skip_dest_index and skip if they match
-                        uint32_t dest_value = common_hal_displayio_bitmap_get_pixel(destination, xd_index, yd_index);
-                        if (dest_value != skip_dest_index) {
-                            if ((skip_source_index_none) || (value != skip_source_index)) {   // write if skip_value_none is True
-                                displayio_bitmap_write_pixel(destination, xd_index, yd_index, value);
-                            }
-                        }
-                    }
+        if (same_depth && bytes_per_value > 0 && skip_dest_index_none &&
+            !rows_overlap(source_row, dest_row, source->stride, destination->stride)) {
+            // Copy each run of pixels between the ones to skip at once.
+            int32_t run_start = src_x1;
+            for (int32_t xs = src_x1; xs <= src_x2; xs++) {
+                if (xs < src_x2 && displayio_bitmap_get_pixel_in_row(source, source_row, xs) != skip_source_index) {
+                    continue;
+                }
+                if (xs > run_start) {
+                    memcpy((uint8_t *)dest_row + (run_start + dx) * bytes_per_value,
+                        (const uint8_t *)source_row + run_start * bytes_per_value, (xs - run_start) * bytes_per_value);
                 }
+                run_start = xs + 1;
+            }
+            continue;
+        }
+
+        for (int32_t i = 0; i < width; i++) {
+            int32_t xs = x_reverse ? src_x2 - i - 1 : src_x1 + i;
+            uint32_t value = displayio_bitmap_get_pixel_in_row(source, source_row, xs);
+            if (!skip_source_index_none && value == skip_source_index) {
+                continue;
+            }
+            if (!skip_dest_index_none &&
+                displayio_bitmap_get_pixel_in_row(destination, dest_row, xs + dx) == skip_dest_index) {
+                continue;
             }
+            displayio_bitmap_set_pixel_in_row(destination, dest_row, xs + dx, value);
         }
     }
 }
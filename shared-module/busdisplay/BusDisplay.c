@@ -196,14 +196,11 @@ mp_obj_t common_hal_busdisplay_busdisplay_get_root_group(busdisplay_busdisplay_o
     return self->core.current_group;
 }
 
+// Setting the region and starting the write takes about as long as sending this many pixels.
+#define AREA_OVERHEAD_PIXELS (64)
+
 static const displayio_area_t *_get_refresh_areas(busdisplay_busdisplay_obj_t *self) {
-    if (self->core.full_refresh) {
-        self->core.area.next = NULL;
-        return &self->core.area;
-    } else if (self->core.current_group != NULL) {
-        return displayio_group_get_refresh_areas(self->core.current_group, NULL);
-    }
-    return NULL;
+    return displayio_display_core_get_refresh_areas(&self->core, AREA_OVERHEAD_PIXELS);
 }
 
 static void _send_pixels(busdisplay_busdisplay_obj_t *self, uint8_t *pixels, uint32_t length) {
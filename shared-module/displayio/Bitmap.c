@@ -89,24 +89,7 @@ uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t
     if (x >= self->width || x < 0 || y >= self->height || y < 0) {
         return 0;
     }
-    int32_t row_start = y * self->stride;
-    uint32_t *row = self->data + row_start;
-    uint8_t bytes_per_value = self->bits_per_value / 8;
-    uint8_t values_per_byte = 8 / self->bits_per_value;
-    if (bytes_per_value < 1) {
-        uint8_t bits = ((uint8_t *)row)[x >> self->x_shift];
-        uint8_t bit_position = (values_per_byte - (x & self->x_mask) - 1) * self->bits_per_value;
-        return (bits >> bit_position) & self->bitmask;
-    } else {
-        if (bytes_per_value == 1) {
-            return ((uint8_t *)row)[x];
-        } else if (bytes_per_value == 2) {
-            return ((uint16_t *)row)[x];
-        } else if (bytes_per_value == 4) {
-            return ((uint32_t *)row)[x];
-        }
-    }
-    return 0;
+    return displayio_bitmap_get_pixel_in_row(self, self->data + y * self->stride, x);
 }
 
 void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_area_t *dirty_area) {
@@ -133,26 +116,7 @@ void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y
         return;
     }
 
-    // Update one pixel of data
-    int32_t row_start = y * self->stride;
-    uint32_t *row = self->data + row_start;
-    uint8_t bytes_per_value = self->bits_per_value / 8;
-    uint8_t values_per_byte = 8 / self->bits_per_value;
-    if (bytes_per_value < 1) {
-        uint8_t bits = ((uint8_t *)row)[x >> self->x_shift];
-        uint8_t bit_position = (values_per_byte - (x & self->x_mask) - 1) * self->bits_per_value;
-        bits &= ~(self->bitmask << bit_position);
-        bits |= (value & self->bitmask) << bit_position;
-        ((uint8_t *)row)[x >> self->x_shift] = bits;
-    } else {
-        if (bytes_per_value == 1) {
-            ((uint8_t *)row)[x] = value;
-        } else if (bytes_per_value == 2) {
-            ((uint16_t *)row)[x] = value;
-        } else if (bytes_per_value == 4) {
-            ((uint32_t *)row)[x] = value;
-        }
-    }
+    displayio_bitmap_set_pixel_in_row(self, self->data + y * self->stride, x, value);
 }
 
 void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
@@ -31,3 +31,42 @@ void displayio_bitmap_finish_refresh(displayio_bitmap_t *self);
 displayio_area_t *displayio_bitmap_get_refresh_areas(displayio_bitmap_t *self, displayio_area_t *tail);
 void displayio_bitmap_set_dirty_area(displayio_bitmap_t *self, const displayio_area_t *area);
 void displayio_bitmap_write_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value);
+
+// Reads the value at x from a row of the bitmap without bounds checking. Inner loops use this
+// after they've clipped to the bitmap once.
+static inline uint32_t displayio_bitmap_get_pixel_in_row(const displayio_bitmap_t *self, const uint32_t *row, uint16_t x) {
+    switch (self->bits_per_value) {
+        case 32:
+            return row[x];
+        case 16:
+            return ((const uint16_t *)row)[x];
+        case 8:
+            return ((const uint8_t *)row)[x];
+        default: {
+            uint8_t bits = ((const uint8_t *)row)[x >> self->x_shift];
+            // x_mask is one less than the number of values per byte.
+            uint8_t bit_position = (self->x_mask - (x & self->x_mask)) * self->bits_per_value;
+            return (bits >> bit_position) & self->bitmask;
+        }
+    }
+}
+
+// Writes value at x into a row of the bitmap without bounds checking.
+static inline void displayio_bitmap_set_pixel_in_row(displayio_bitmap_t *self, uint32_t *row, uint16_t x, uint32_t value) {
+    switch (self->bits_per_value) {
+        case 32:
+            row[x] = value;
+            break;
+        case 16:
+            ((uint16_t *)row)[x] = value;
+            break;
+        case 8:
+            ((uint8_t *)row)[x] = value;
+            break;
+        default: {
+            uint8_t *bits = &((uint8_t *)row)[x >> self->x_shift];
+            uint8_t bit_position = (self->x_mask - (x & self->x_mask)) * self->bits_per_value;
+            *bits = (*bits & ~(self->bitmask << bit_position)) | ((value & self->bitmask) << bit_position);
+        }
+    }
+}
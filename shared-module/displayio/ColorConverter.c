@@ -376,6 +376,19 @@ void displayio_convert_color(const _displayio_colorspace_t *colorspace, bool dit
     output_color->opaque = false;
 }
 
+// Returns true when displayio_convert_color produces an opaque pixel for every color in the
+// colorspace. This must match the cases handled above.
+bool displayio_convert_color_is_opaque(const _displayio_colorspace_t *colorspace) {
+    return colorspace->depth == 16 ||
+           colorspace->tricolor ||
+           colorspace->fourcolor ||
+           (colorspace->grayscale && colorspace->depth <= 8) ||
+           colorspace->depth == 32 ||
+           colorspace->depth == 24 ||
+           colorspace->depth == 8 ||
+           colorspace->depth == 4;
+}
+
 void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t pixel = input_pixel->pixel;
 
@@ -402,6 +415,10 @@ void displayio_colorconverter_convert(displayio_colorconverter_t *self, const _d
 
 
 
+bool displayio_colorconverter_is_opaque(displayio_colorconverter_t *self, const _displayio_colorspace_t *colorspace) {
+    return self->transparent_color == NO_TRANSPARENT_COLOR && displayio_convert_color_is_opaque(colorspace);
+}
+
 // Currently no refresh logic is needed for a ColorConverter.
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self) {
     return false;
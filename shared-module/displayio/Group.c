@@ -375,6 +375,10 @@ bool displayio_group_fill_area(displayio_group_t *self, const _displayio_colorsp
     // Track if any of the layers finishes filling in the given area. We can ignore any remaining
     // layers at that point.
     if (self->hidden == false) {
+        // Layers above us may have already covered the whole area between them.
+        if (displayio_area_mask_all_set(mask, displayio_area_size(area))) {
+            return true;
+        }
         for (int32_t i = self->members->len - 1; i >= 0; i--) {
             mp_obj_t layer;
             #if CIRCUITPY_VECTORIO
@@ -13,6 +13,7 @@
 
 #include <string.h>
 
+#include "py/gc.h"
 #include "py/mperrno.h"
 #include "py/runtime.h"
 
@@ -25,7 +26,7 @@ static uint32_t read_word(uint16_t *bmp_header, uint16_t index) {
     return bmp_header[index] | bmp_header[index + 1] << 16;
 }
 
-void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file) {
+void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self, pyb_file_obj_t *file, uint16_t cache_rows) {
     // Load the wave
     self->file = file;
     uint16_t bmp_header[69];
@@ -158,6 +159,54 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    self->cache_rows = MIN(cache_rows, self->height);
+    self->cached_row_start = 0;
+    self->cached_row_count = 0;
+    self->cached_row_failed = false;
+    // Allocated when first drawn so bitmaps that are never shown don't hold a cache.
+    self->row_cache = NULL;
+}
+
+// Returns the file data for row y. Rows are read cache_rows at a time with a single read so that
+// drawing the bitmap from top to bottom reads the file sequentially. Returns NULL when the row
+// isn't cached and can't be read.
+const uint8_t *displayio_ondiskbitmap_get_row(displayio_ondiskbitmap_t *self, int16_t y) {
+    if (self->cache_rows == 0 || y < 0 || y >= self->height) {
+        return NULL;
+    }
+    if (self->row_cache == NULL) {
+        if (!gc_alloc_possible()) {
+            return NULL;
+        }
+        self->row_cache = m_malloc_maybe_without_collect((size_t)self->cache_rows * self->stride);
+        if (self->row_cache == NULL) {
+            // Not enough memory so read pixel by pixel from now on.
+            self->cache_rows = 0;
+            return NULL;
+        }
+    }
+    // Don't retry a failed read for every pixel in the row.
+    if (self->cached_row_failed && y == self->cached_row_start) {
+        return NULL;
+    }
+    if (y < self->cached_row_start || y >= self->cached_row_start + self->cached_row_count) {
+        uint16_t count = MIN(self->cache_rows, self->height - y);
+        // Rows are stored bottom to top so the strip starts with the last row.
+        uint32_t location = self->data_offset + (self->height - y - count) * self->stride;
+        UINT size = count * self->stride;
+        UINT bytes_read;
+        self->cached_row_start = y;
+        self->cached_row_count = 0;
+        self->cached_row_failed = true;
+        if (f_lseek(&self->file->fp, location) != FR_OK ||
+            f_read(&self->file->fp, self->row_cache, size, &bytes_read) != FR_OK ||
+            bytes_read != size) {
+            return NULL;
+        }
+        self->cached_row_count = count;
+        self->cached_row_failed = false;
+    }
+    return self->row_cache + (self->cached_row_start + self->cached_row_count - 1 - y) * self->stride;
 }
 
 
@@ -167,6 +216,14 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
         return 0;
     }
 
+    const uint8_t *row = displayio_ondiskbitmap_get_row(self, y);
+    if (row != NULL) {
+        return displayio_ondiskbitmap_get_pixel_in_row(self, row, x);
+    }
+    if (self->cached_row_failed && y == self->cached_row_start) {
+        return 0;
+    }
+
     uint32_t location;
     uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel / 8) : 1;
     uint8_t pixels_per_byte = 8 / self->bits_per_pixel;
@@ -175,38 +232,13 @@ uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *s
     } else {
         location = self->data_offset + (self->height - y - 1) * self->stride + x / pixels_per_byte;
     }
-    // We don't cache here because the underlying FS caches sectors.
+    // Without a row cache we rely on the underlying FS caching sectors.
     f_lseek(&self->file->fp, location);
     UINT bytes_read;
     uint32_t pixel_data = 0;
     uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
     if (result == FR_OK) {
-        uint32_t tmp = 0;
-        uint8_t red;
-        uint8_t green;
-        uint8_t blue;
-        if (bytes_per_pixel == 1) {
-            uint8_t offset = (x % pixels_per_byte) * self->bits_per_pixel;
-            uint8_t mask = (1 << self->bits_per_pixel) - 1;
-
-            return (pixel_data >> ((8 - self->bits_per_pixel) - offset)) & mask;
-        } else if (bytes_per_pixel == 2) {
-            if (self->g_bitmask == 0x07e0) { // 565
-                red = ((pixel_data & self->r_bitmask) >> 11);
-                green = ((pixel_data & self->g_bitmask) >> 5);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
-            } else { // 555
-                red = ((pixel_data & self->r_bitmask) >> 10);
-                green = ((pixel_data & self->g_bitmask) >> 4);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
-            }
-            tmp = (red << 19 | green << 10 | blue << 3);
-            return tmp;
-        } else if ((bytes_per_pixel == 4) && (self->bitfield_compressed)) {
-            return pixel_data & 0x00FFFFFF;
-        } else {
-            return pixel_data;
-        }
+        return displayio_ondiskbitmap_decode_pixel(self, pixel_data, x);
     }
     return 0;
 }
@@ -8,6 +8,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "py/obj.h"
 
@@ -28,6 +29,58 @@ typedef struct {
         struct displayio_palette *palette;
         struct displayio_colorconverter *colorconverter;
     };
+    // Raw file data for cached_row_count rows starting at cached_row_start. The rows are in
+    // file order so the last row comes first. NULL until first drawn or when reading pixel by
+    // pixel.
+    uint8_t *row_cache;
+    uint16_t cache_rows;
+    uint16_t cached_row_start;
+    uint16_t cached_row_count;
+    // Set when the strip starting at cached_row_start couldn't be read.
+    bool cached_row_failed;
     bool bitfield_compressed;
     uint8_t bits_per_pixel;
 } displayio_ondiskbitmap_t;
+
+const uint8_t *displayio_ondiskbitmap_get_row(displayio_ondiskbitmap_t *self, int16_t y);
+
+// Converts the file data for the pixel at x into the value passed to the pixel shader. pixel_data
+// is the byte holding x when there are multiple pixels per byte.
+static inline uint32_t displayio_ondiskbitmap_decode_pixel(const displayio_ondiskbitmap_t *self, uint32_t pixel_data, uint16_t x) {
+    uint8_t bits_per_pixel = self->bits_per_pixel;
+    if (bits_per_pixel <= 8) {
+        uint8_t pixels_per_byte = 8 / bits_per_pixel;
+        uint8_t offset = (x % pixels_per_byte) * bits_per_pixel;
+        uint8_t mask = (1 << bits_per_pixel) - 1;
+
+        return (pixel_data >> ((8 - bits_per_pixel) - offset)) & mask;
+    } else if (bits_per_pixel == 16) {
+        uint8_t red;
+        uint8_t green;
+        uint8_t blue;
+        if (self->g_bitmask == 0x07e0) { // 565
+            red = ((pixel_data & self->r_bitmask) >> 11);
+            green = ((pixel_data & self->g_bitmask) >> 5);
+            blue = ((pixel_data & self->b_bitmask) >> 0);
+        } else { // 555
+            red = ((pixel_data & self->r_bitmask) >> 10);
+            green = ((pixel_data & self->g_bitmask) >> 4);
+            blue = ((pixel_data & self->b_bitmask) >> 0);
+        }
+        return red << 19 | green << 10 | blue << 3;
+    } else if (bits_per_pixel == 32 && self->bitfield_compressed) {
+        return pixel_data & 0x00FFFFFF;
+    }
+    return pixel_data;
+}
+
+// Reads the value at x from a row returned by displayio_ondiskbitmap_get_row() without bounds
+// checking.
+static inline uint32_t displayio_ondiskbitmap_get_pixel_in_row(const displayio_ondiskbitmap_t *self, const uint8_t *row, uint16_t x) {
+    if (self->bits_per_pixel <= 8) {
+        return displayio_ondiskbitmap_decode_pixel(self, row[x / (8 / self->bits_per_pixel)], x);
+    }
+    uint32_t pixel_data = 0;
+    memcpy(&pixel_data, row + x * (self->bits_per_pixel / 8), self->bits_per_pixel / 8);
+    return displayio_ondiskbitmap_decode_pixel(self, pixel_data, x);
+}
@@ -11,7 +11,18 @@
 void common_hal_displayio_palette_construct(displayio_palette_t *self, uint16_t color_count, bool dither) {
     self->color_count = color_count;
     self->colors = (_displayio_color_t *)m_malloc_without_collect(color_count * sizeof(_displayio_color_t));
+    self->native_colors = (uint32_t *)m_malloc_without_collect(color_count * sizeof(uint32_t));
+    self->native_colorspace = NULL;
     self->dither = dither;
+    self->opaque = true;
+}
+
+// Marks the color as changed so that it is converted again and the palette is redrawn.
+static void _palette_color_changed(displayio_palette_t *self, uint32_t palette_index) {
+    if (self->native_colors != NULL) {
+        self->native_colors[palette_index] = DISPLAYIO_PALETTE_NATIVE_STALE;
+    }
+    self->needs_refresh = true;
 }
 
 void common_hal_displayio_palette_set_dither(displayio_palette_t *self, bool dither) {
@@ -23,13 +34,25 @@ bool common_hal_displayio_palette_get_dither(displayio_palette_t *self) {
 }
 
 void common_hal_displayio_palette_make_opaque(displayio_palette_t *self, uint32_t palette_index) {
+    bool was_transparent = self->colors[palette_index].transparent;
     self->colors[palette_index].transparent = false;
-    self->needs_refresh = true;
+    _palette_color_changed(self, palette_index);
+    // Only rescan when we may have just made the last transparent color opaque.
+    if (self->opaque || !was_transparent) {
+        return;
+    }
+    for (uint32_t i = 0; i < self->color_count; i++) {
+        if (self->colors[i].transparent) {
+            return;
+        }
+    }
+    self->opaque = true;
 }
 
 void common_hal_displayio_palette_make_transparent(displayio_palette_t *self, uint32_t palette_index) {
     self->colors[palette_index].transparent = true;
-    self->needs_refresh = true;
+    self->opaque = false;
+    _palette_color_changed(self, palette_index);
 }
 
 bool common_hal_displayio_palette_is_transparent(displayio_palette_t *self, uint32_t palette_index) {
@@ -46,36 +69,79 @@ void common_hal_displayio_palette_set_color(displayio_palette_t *self, uint32_t
     }
     self->colors[palette_index].rgb888 = color;
     self->colors[palette_index].cached_colorspace = NULL;
-    self->needs_refresh = true;
+    _palette_color_changed(self, palette_index);
 }
 
 uint32_t common_hal_displayio_palette_get_color(displayio_palette_t *self, uint32_t palette_index) {
     return self->colors[palette_index].rgb888;
 }
 
+// Returns the palette's colors converted to the given colorspace, indexed by palette index, or
+// NULL if they can't be cached. Entries may be DISPLAYIO_PALETTE_NATIVE_TRANSPARENT or
+// DISPLAYIO_PALETTE_NATIVE_STALE. displayio_palette_get_color() fills in stale entries.
+const uint32_t *displayio_palette_get_native_colors(displayio_palette_t *self, const _displayio_colorspace_t *colorspace) {
+    // Dithered colors depend on the pixel location.
+    if (self->native_colors == NULL || self->dither) {
+        return NULL;
+    }
+    // Check the grayscale settings because EPaperDisplay will change them on
+    // the same object.
+    if (self->native_colorspace != colorspace ||
+        self->native_grayscale_bit != colorspace->grayscale_bit ||
+        self->native_grayscale != colorspace->grayscale) {
+        for (uint32_t i = 0; i < self->color_count; i++) {
+            self->native_colors[i] = DISPLAYIO_PALETTE_NATIVE_STALE;
+        }
+        self->native_colorspace = colorspace;
+        self->native_grayscale_bit = colorspace->grayscale_bit;
+        self->native_grayscale = colorspace->grayscale;
+    }
+    return self->native_colors;
+}
+
 void displayio_palette_get_color(displayio_palette_t *self, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color) {
     uint32_t palette_index = input_pixel->pixel;
-    if (palette_index > self->color_count || self->colors[palette_index].transparent) {
+    if (palette_index >= self->color_count) {
         output_color->opaque = false;
         return;
     }
 
-    // Cache results when not dithering.
     _displayio_color_t *color = &self->colors[palette_index];
-    // Check the grayscale settings because EPaperDisplay will change them on
-    // the same object.
-    if (!self->dither &&
+    const uint32_t *native_colors = displayio_palette_get_native_colors(self, colorspace);
+    if (native_colors != NULL && native_colors[palette_index] != DISPLAYIO_PALETTE_NATIVE_STALE) {
+        output_color->pixel = native_colors[palette_index];
+        output_color->opaque = output_color->pixel != DISPLAYIO_PALETTE_NATIVE_TRANSPARENT;
+        return;
+    }
+    if (color->transparent) {
+        if (native_colors != NULL) {
+            self->native_colors[palette_index] = DISPLAYIO_PALETTE_NATIVE_TRANSPARENT;
+        }
+        output_color->opaque = false;
+        return;
+    }
+
+    // Statically defined palettes cache results in each color instead. Check the grayscale
+    // settings because EPaperDisplay will change them on the same object.
+    if (native_colors == NULL &&
+        !self->dither &&
         color->cached_colorspace == colorspace &&
         color->cached_colorspace_grayscale_bit == colorspace->grayscale_bit &&
         color->cached_colorspace_grayscale == colorspace->grayscale) {
-        output_color->pixel = self->colors[palette_index].cached_color;
+        output_color->pixel = color->cached_color;
         return;
     }
 
     displayio_input_pixel_t rgb888_pixel = *input_pixel;
-    rgb888_pixel.pixel = self->colors[palette_index].rgb888;
+    rgb888_pixel.pixel = color->rgb888;
     displayio_convert_color(colorspace, self->dither, &rgb888_pixel, output_color);
-    if (!self->dither) {
+    if (native_colors != NULL) {
+        if (!output_color->opaque) {
+            self->native_colors[palette_index] = DISPLAYIO_PALETTE_NATIVE_TRANSPARENT;
+        } else if (output_color->pixel < DISPLAYIO_PALETTE_NATIVE_STALE) {
+            self->native_colors[palette_index] = output_color->pixel;
+        }
+    } else if (!self->dither) {
         color->cached_colorspace = colorspace;
         color->cached_color = output_color->pixel;
         color->cached_colorspace_grayscale = colorspace->grayscale;
@@ -83,6 +149,11 @@ void displayio_palette_get_color(displayio_palette_t *self, const _displayio_col
     }
 }
 
+// Returns true when every color in the palette converts to an opaque pixel in colorspace.
+bool displayio_palette_is_opaque(displayio_palette_t *self, const _displayio_colorspace_t *colorspace) {
+    return self->opaque && displayio_convert_color_is_opaque(colorspace);
+}
+
 bool displayio_palette_needs_refresh(displayio_palette_t *self) {
     return self->needs_refresh;
 }
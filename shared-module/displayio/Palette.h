@@ -51,16 +51,28 @@ typedef struct {
     bool opaque;
 } displayio_output_pixel_t;
 
+// Values in a palette's native_colors that aren't converted pixels. Pixels that don't fit below
+// these are never cached.
+#define DISPLAYIO_PALETTE_NATIVE_STALE (0xfffffffe)
+#define DISPLAYIO_PALETTE_NATIVE_TRANSPARENT (0xffffffff)
+
 typedef struct displayio_palette {
     mp_obj_base_t base;
     _displayio_color_t *colors;
+    // Colors already converted to native_colorspace. NULL for statically defined palettes.
+    uint32_t *native_colors;
+    const _displayio_colorspace_t *native_colorspace;
     uint32_t color_count;
+    uint8_t native_grayscale_bit;
+    bool native_grayscale;
     bool needs_refresh;
     bool dither;
+    bool opaque; // True when no colors are transparent. Statically defined palettes leave it false.
 } displayio_palette_t;
 
 
 void displayio_palette_get_color(displayio_palette_t *palette, const _displayio_colorspace_t *colorspace, const displayio_input_pixel_t *input_pixel, displayio_output_pixel_t *output_color);
-;
+const uint32_t *displayio_palette_get_native_colors(displayio_palette_t *self, const _displayio_colorspace_t *colorspace);
 bool displayio_palette_needs_refresh(displayio_palette_t *self);
+bool displayio_palette_is_opaque(displayio_palette_t *self, const _displayio_colorspace_t *colorspace);
 void displayio_palette_finish_refresh(displayio_palette_t *self);
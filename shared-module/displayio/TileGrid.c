@@ -62,6 +62,14 @@ void common_hal_displayio_tilegrid_construct(displayio_tilegrid_t *self, mp_obj_
         self->inline_tiles = false;
     }
 
+    self->dirty_tiles = NULL;
+    self->dirty_tile_areas = NULL;
+    if (total_tiles >= DISPLAYIO_TILEGRID_DIRTY_TILES_MIN) {
+        self->dirty_tiles = (uint32_t *)m_malloc_without_collect(((total_tiles + 31) / 32) * sizeof(uint32_t));
+        memset(self->dirty_tiles, 0, ((total_tiles + 31) / 32) * sizeof(uint32_t));
+        self->dirty_tile_areas = (displayio_area_t *)m_malloc_without_collect(DISPLAYIO_TILEGRID_DIRTY_TILE_AREA_COUNT * sizeof(displayio_area_t));
+    }
+
     self->width_in_tiles = width;
     self->height_in_tiles = height;
     self->x = x;
@@ -305,6 +313,10 @@ void displayio_tilegrid_mark_tile_dirty(displayio_tilegrid_t *self, uint16_t x,
     }
     tile_area->y1 = ty * self->tile_height;
     tile_area->y2 = tile_area->y1 + self->tile_height;
+    if (self->dirty_tiles != NULL) {
+        uint32_t index = ty * self->width_in_tiles + tx;
+        self->dirty_tiles[index / 32] |= 1u << (index % 32);
+    }
 
     if (self->partial_change) {
         displayio_area_union(&self->dirty_area, &temp_area, &self->dirty_area);
@@ -425,6 +437,190 @@ void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint
     self->full_change = true;
 }
 
+// The bitmap and pixel shader types are resolved once per fill so that the inner loop doesn't
+// need to check object types for every pixel.
+typedef enum {
+    TILEGRID_SOURCE_NONE,
+    TILEGRID_SOURCE_BITMAP,
+    TILEGRID_SOURCE_ONDISKBITMAP,
+} tilegrid_source_t;
+
+typedef enum {
+    TILEGRID_SHADER_NONE,
+    TILEGRID_SHADER_PALETTE,
+    TILEGRID_SHADER_COLORCONVERTER,
+    #if CIRCUITPY_TILEPALETTEMAPPER
+    TILEGRID_SHADER_TILEPALETTEMAPPER,
+    #endif
+} tilegrid_shader_t;
+
+// State that is constant for a whole fill_area call.
+typedef struct {
+    displayio_tilegrid_t *tilegrid;
+    const _displayio_colorspace_t *colorspace;
+    uint32_t *mask;
+    uint32_t *buffer;
+    uint16_t area_width;
+    int16_t x_stride;
+    uint8_t scale;
+    tilegrid_source_t source;
+    tilegrid_shader_t shader;
+    // Palette colors already converted to the colorspace. NULL when they aren't cached.
+    const uint32_t *native_colors;
+    uint32_t color_count;
+    bool check_mask; // False when nothing has been drawn into the area yet.
+    bool set_mask; // False when the mask is updated in bulk after the fill.
+} tilegrid_fill_t;
+
+// Returns true if every pixel we draw will be opaque. In that case the whole overlap is covered
+// once we're done and coverage doesn't need to be tracked per pixel.
+static bool _tilegrid_is_opaque(const tilegrid_fill_t *fill) {
+    displayio_tilegrid_t *self = fill->tilegrid;
+    switch (fill->shader) {
+        case TILEGRID_SHADER_NONE:
+            return fill->source != TILEGRID_SOURCE_NONE;
+        case TILEGRID_SHADER_COLORCONVERTER:
+            return displayio_colorconverter_is_opaque(self->pixel_shader, fill->colorspace);
+        case TILEGRID_SHADER_PALETTE: {
+            // Values past the end of the palette are transparent so the bitmap must not be able
+            // to hold any.
+            uint8_t bits_per_value;
+            if (fill->source == TILEGRID_SOURCE_BITMAP) {
+                bits_per_value = ((displayio_bitmap_t *)self->bitmap)->bits_per_value;
+            } else if (fill->source == TILEGRID_SOURCE_ONDISKBITMAP) {
+                bits_per_value = ((displayio_ondiskbitmap_t *)self->bitmap)->bits_per_pixel;
+            } else {
+                return false;
+            }
+            displayio_palette_t *palette = self->pixel_shader;
+            return bits_per_value <= 16 && (1u << bits_per_value) <= palette->color_count &&
+                   displayio_palette_is_opaque(palette, fill->colorspace);
+        }
+        default:
+            return false;
+    }
+}
+
+__attribute__((always_inline))
+static inline void _write_pixel(const tilegrid_fill_t *fill, uint8_t depth, int32_t offset, uint32_t pixel) {
+    uint32_t *buffer = fill->buffer;
+    if (depth == 16) {
+        *(((uint16_t *)buffer) + offset) = pixel;
+    } else if (depth == 32) {
+        *(((uint32_t *)buffer) + offset) = pixel;
+    } else if (depth == 24) {
+        memcpy(((uint8_t *)buffer) + offset * 3, &pixel, 3);
+    } else if (depth == 8) {
+        *(((uint8_t *)buffer) + offset) = pixel;
+    } else if (depth < 8) {
+        const _displayio_colorspace_t *colorspace = fill->colorspace;
+        uint8_t pixels_per_byte = 8 / depth;
+
+        // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
+        if (!colorspace->pixels_in_byte_share_row) {
+            uint16_t width = fill->area_width;
+            uint16_t row = offset / width;
+            uint16_t col = offset % width;
+            // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
+            offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
+            // Also useful for validating that the bitpacking worked correctly.
+            // if (offset > displayio_area_size(area)) {
+            //     asm("bkpt");
+            // }
+        }
+        uint8_t shift = (offset % pixels_per_byte) * depth;
+        if (colorspace->reverse_pixels_in_byte) {
+            // Reverse the shift by subtracting it from the leftmost shift.
+            shift = (pixels_per_byte - 1) * depth - shift;
+        }
+        ((uint8_t *)buffer)[offset / pixels_per_byte] |= pixel << shift;
+    }
+}
+
+// Fills the run of pixels in one row that all come from the same tile, starting at
+// input_pixel->x and ending before span_end. row is the bitmap row holding the span, or NULL when
+// the span can't be read a row at a time. depth is passed separately from the colorspace so that the
+// compiler can specialize the common 16 bit case. Returns false if any pixel was transparent.
+__attribute__((always_inline))
+static inline bool _fill_span(const tilegrid_fill_t *fill, uint8_t depth,
+    displayio_input_pixel_t *input_pixel, int16_t span_end, int32_t offset,
+    const void *row, uint16_t x_tile_index, uint16_t y_tile_index) {
+    displayio_tilegrid_t *self = fill->tilegrid;
+    uint32_t *mask = fill->mask;
+    bool opaque = true;
+    uint8_t scale_count = input_pixel->x % fill->scale;
+    for (; input_pixel->x < span_end; ++input_pixel->x) {
+        // This is super useful for debugging out of range accesses. Uncomment to use.
+        // if (offset < 0 || offset >= (int32_t) displayio_area_size(area)) {
+        //     asm("bkpt");
+        // }
+
+        // Check the mask first to see if the pixel has already been set.
+        if (!fill->check_mask || (mask[offset / 32] & (1 << (offset % 32))) == 0) {
+            // We always want to read bitmap pixels by row first and then transpose into the
+            // destination buffer because most bitmaps are row associated.
+            input_pixel->pixel = 0;
+            if (row != NULL) {
+                if (fill->source == TILEGRID_SOURCE_BITMAP) {
+                    input_pixel->pixel = displayio_bitmap_get_pixel_in_row(self->bitmap, row, input_pixel->tile_x);
+                } else {
+                    input_pixel->pixel = displayio_ondiskbitmap_get_pixel_in_row(self->bitmap, row, input_pixel->tile_x);
+                }
+            } else if (fill->source == TILEGRID_SOURCE_BITMAP) {
+                input_pixel->pixel = common_hal_displayio_bitmap_get_pixel(self->bitmap, input_pixel->tile_x, input_pixel->tile_y);
+            } else if (fill->source == TILEGRID_SOURCE_ONDISKBITMAP) {
+                input_pixel->pixel = common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, input_pixel->tile_x, input_pixel->tile_y);
+            }
+
+            displayio_output_pixel_t output_pixel;
+            output_pixel.pixel = 0;
+            output_pixel.opaque = true;
+            switch (fill->shader) {
+                case TILEGRID_SHADER_PALETTE:
+                    if (fill->native_colors != NULL && input_pixel->pixel < fill->color_count) {
+                        uint32_t native_color = fill->native_colors[input_pixel->pixel];
+                        if (native_color < DISPLAYIO_PALETTE_NATIVE_STALE) {
+                            output_pixel.pixel = native_color;
+                            break;
+                        } else if (native_color == DISPLAYIO_PALETTE_NATIVE_TRANSPARENT) {
+                            output_pixel.opaque = false;
+                            break;
+                        }
+                    }
+                    // Converts the color and fills in the stale entry.
+                    displayio_palette_get_color(self->pixel_shader, fill->colorspace, input_pixel, &output_pixel);
+                    break;
+                case TILEGRID_SHADER_COLORCONVERTER:
+                    displayio_colorconverter_convert(self->pixel_shader, fill->colorspace, input_pixel, &output_pixel);
+                    break;
+                #if CIRCUITPY_TILEPALETTEMAPPER
+                case TILEGRID_SHADER_TILEPALETTEMAPPER:
+                    tilepalettemapper_tilepalettemapper_get_color(self->pixel_shader, fill->colorspace, input_pixel, &output_pixel, x_tile_index, y_tile_index);
+                    break;
+                #endif
+                default:
+                    output_pixel.pixel = input_pixel->pixel;
+                    break;
+            }
+            if (!output_pixel.opaque) {
+                // A pixel is transparent so we haven't fully covered the area ourselves.
+                opaque = false;
+            } else {
+                if (fill->set_mask) {
+                    mask[offset / 32] |= 1 << (offset % 32);
+                }
+                _write_pixel(fill, depth, offset, output_pixel.pixel);
+            }
+        }
+        offset += fill->x_stride;
+        if (++scale_count == fill->scale) {
+            scale_count = 0;
+            input_pixel->tile_x++;
+        }
+    }
+    return opaque;
+}
+
 bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     const _displayio_colorspace_t *colorspace, const displayio_area_t *area,
     uint32_t *mask, uint32_t *buffer) {
@@ -473,11 +669,6 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
     // layers at that point.
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    // TODO(tannewt): Skip coverage tracking if all pixels outside the overlap have already been
-    // set and our palette is all opaque.
-
-    // TODO(tannewt): Check to see if the pixel_shader has any transparency. If it doesn't then we
-    // can either return full coverage or bulk update the mask.
     displayio_area_t transformed;
     displayio_area_transform_within(flip_x != (self->absolute_transform->dx < 0), flip_y != (self->absolute_transform->dy < 0), self->transpose_xy != self->absolute_transform->transpose_xy,
         &overlap,
@@ -512,97 +703,106 @@ bool displayio_tilegrid_fill_area(displayio_tilegrid_t *self,
         y_shift = temp_shift;
     }
 
-    displayio_input_pixel_t input_pixel;
-    displayio_output_pixel_t output_pixel;
+    tilegrid_fill_t fill;
+    fill.tilegrid = self;
+    fill.colorspace = colorspace;
+    fill.mask = mask;
+    fill.buffer = buffer;
+    fill.area_width = displayio_area_width(area);
+    fill.x_stride = x_stride;
+    fill.scale = self->absolute_transform->scale;
 
-    for (input_pixel.y = start_y; input_pixel.y < end_y; ++input_pixel.y) {
-        int16_t row_start = start + (input_pixel.y - start_y + y_shift) * y_stride; // in pixels
-        int16_t local_y = input_pixel.y / self->absolute_transform->scale;
-        for (input_pixel.x = start_x; input_pixel.x < end_x; ++input_pixel.x) {
-            // Compute the destination pixel in the buffer and mask based on the transformations.
-            int16_t offset = row_start + (input_pixel.x - start_x + x_shift) * x_stride; // in pixels
-
-            // This is super useful for debugging out of range accesses. Uncomment to use.
-            // if (offset < 0 || offset >= (int32_t) displayio_area_size(area)) {
-            //     asm("bkpt");
-            // }
+    displayio_bitmap_t *bitmap = NULL;
+    displayio_ondiskbitmap_t *ondiskbitmap = NULL;
+    fill.source = TILEGRID_SOURCE_NONE;
+    if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
+        fill.source = TILEGRID_SOURCE_BITMAP;
+        bitmap = self->bitmap;
+    } else if (mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
+        fill.source = TILEGRID_SOURCE_ONDISKBITMAP;
+        ondiskbitmap = self->bitmap;
+    }
 
-            // Check the mask first to see if the pixel has already been set.
-            if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
-                continue;
-            }
-            int16_t local_x = input_pixel.x / self->absolute_transform->scale;
-            uint16_t x_tile_index = (local_x / self->tile_width + self->top_left_x) % self->width_in_tiles;
-            uint16_t y_tile_index = (local_y / self->tile_height + self->top_left_y) % self->height_in_tiles;
-            uint16_t tile_location = y_tile_index * self->width_in_tiles + x_tile_index;
+    fill.shader = TILEGRID_SHADER_NONE;
+    fill.native_colors = NULL;
+    if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
+        fill.shader = TILEGRID_SHADER_PALETTE;
+        displayio_palette_t *palette = self->pixel_shader;
+        fill.native_colors = displayio_palette_get_native_colors(palette, colorspace);
+        fill.color_count = palette->color_count;
+    } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
+        fill.shader = TILEGRID_SHADER_COLORCONVERTER;
+    #if CIRCUITPY_TILEPALETTEMAPPER
+    } else if (mp_obj_is_type(self->pixel_shader, &tilepalettemapper_tilepalettemapper_type)) {
+        fill.shader = TILEGRID_SHADER_TILEPALETTEMAPPER;
+    #endif
+    }
 
+    // When every pixel is opaque the mask is updated in bulk afterwards. If nothing has been drawn
+    // into the area yet, we don't need to test the mask for each pixel either.
+    bool opaque = _tilegrid_is_opaque(&fill);
+    fill.set_mask = !opaque;
+    fill.check_mask = !opaque || !displayio_area_mask_all_clear(mask, displayio_area_size(area));
+
+    uint16_t tile_width = self->tile_width;
+    uint16_t tile_height = self->tile_height;
+    displayio_input_pixel_t input_pixel;
+
+    for (input_pixel.y = start_y; input_pixel.y < end_y; ++input_pixel.y) {
+        int32_t row_start = start + (input_pixel.y - start_y + y_shift) * y_stride; // in pixels
+        int16_t local_y = input_pixel.y / fill.scale;
+        uint16_t y_tile_index = (local_y / tile_height + self->top_left_y) % self->height_in_tiles;
+        uint16_t y_in_tile = local_y % tile_height;
+        uint32_t tile_row = y_tile_index * self->width_in_tiles;
+
+        input_pixel.x = start_x;
+        while (input_pixel.x < end_x) {
+            int16_t local_x = input_pixel.x / fill.scale;
+            uint16_t x_in_tile = local_x % tile_width;
+            uint16_t x_tile_index = (local_x / tile_width + self->top_left_x) % self->width_in_tiles;
+            // Every pixel up to the next tile boundary comes from the same tile.
+            int16_t span_end = MIN(end_x, (local_x - x_in_tile + tile_width) * fill.scale);
+
+            uint16_t tile;
             if (self->tiles_in_bitmap > 255) {
-                input_pixel.tile = ((uint16_t *)tiles)[tile_location];
+                tile = ((uint16_t *)tiles)[tile_row + x_tile_index];
             } else {
-                input_pixel.tile = ((uint8_t *)tiles)[tile_location];
+                tile = ((uint8_t *)tiles)[tile_row + x_tile_index];
             }
-            input_pixel.tile_x = (input_pixel.tile % self->bitmap_width_in_tiles) * self->tile_width + local_x % self->tile_width;
-            input_pixel.tile_y = (input_pixel.tile / self->bitmap_width_in_tiles) * self->tile_height + local_y % self->tile_height;
-
-            output_pixel.pixel = 0;
-            input_pixel.pixel = 0;
-
-            // We always want to read bitmap pixels by row first and then transpose into the destination
-            // buffer because most bitmaps are row associated.
-            if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
-                input_pixel.pixel = common_hal_displayio_bitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
-            } else if (mp_obj_is_type(self->bitmap, &displayio_ondiskbitmap_type)) {
-                input_pixel.pixel = common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, input_pixel.tile_x, input_pixel.tile_y);
+            input_pixel.tile = tile;
+            uint16_t tile_x_start = (tile % self->bitmap_width_in_tiles) * tile_width;
+            input_pixel.tile_x = tile_x_start + x_in_tile;
+            input_pixel.tile_y = (tile / self->bitmap_width_in_tiles) * tile_height + y_in_tile;
+
+            const void *row = NULL;
+            if (bitmap != NULL && input_pixel.tile_y < bitmap->height &&
+                tile_x_start + tile_width <= bitmap->width) {
+                row = bitmap->data + input_pixel.tile_y * bitmap->stride;
+            } else if (ondiskbitmap != NULL && tile_x_start + tile_width <= ondiskbitmap->width) {
+                // Fetches the whole row from the file once instead of seeking for each pixel.
+                row = displayio_ondiskbitmap_get_row(ondiskbitmap, input_pixel.tile_y);
             }
 
-            output_pixel.opaque = true;
-            #if CIRCUITPY_TILEPALETTEMAPPER
-            if (mp_obj_is_type(self->pixel_shader, &tilepalettemapper_tilepalettemapper_type)) {
-                tilepalettemapper_tilepalettemapper_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel, x_tile_index, y_tile_index);
-            }
-            #endif
-            if (self->pixel_shader == mp_const_none) {
-                output_pixel.pixel = input_pixel.pixel;
-            } else if (mp_obj_is_type(self->pixel_shader, &displayio_palette_type)) {
-                displayio_palette_get_color(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
-            } else if (mp_obj_is_type(self->pixel_shader, &displayio_colorconverter_type)) {
-                displayio_colorconverter_convert(self->pixel_shader, colorspace, &input_pixel, &output_pixel);
+            int32_t offset = row_start + (input_pixel.x - start_x + x_shift) * x_stride; // in pixels
+            bool span_opaque;
+            if (colorspace->depth == 16) {
+                span_opaque = _fill_span(&fill, 16, &input_pixel, span_end, offset, row, x_tile_index, y_tile_index);
+            } else {
+                span_opaque = _fill_span(&fill, colorspace->depth, &input_pixel, span_end, offset, row, x_tile_index, y_tile_index);
             }
-            if (!output_pixel.opaque) {
-                // A pixel is transparent so we haven't fully covered the area ourselves.
+            if (!span_opaque) {
                 full_coverage = false;
-            } else {
-                mask[offset / 32] |= 1 << (offset % 32);
-                if (colorspace->depth == 16) {
-                    *(((uint16_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth == 32) {
-                    *(((uint32_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth == 24) {
-                    memcpy(((uint8_t *)buffer) + offset * 3, &output_pixel.pixel, 3);
-                } else if (colorspace->depth == 8) {
-                    *(((uint8_t *)buffer) + offset) = output_pixel.pixel;
-                } else if (colorspace->depth < 8) {
-                    uint8_t pixels_per_byte = 8 / colorspace->depth;
-
-                    // Reorder the offsets to pack multiple rows into a byte (meaning they share a column).
-                    if (!colorspace->pixels_in_byte_share_row) {
-                        uint16_t width = displayio_area_width(area);
-                        uint16_t row = offset / width;
-                        uint16_t col = offset % width;
-                        // Dividing by pixels_per_byte does truncated division even if we multiply it back out.
-                        offset = col * pixels_per_byte + (row / pixels_per_byte) * pixels_per_byte * width + row % pixels_per_byte;
-                        // Also useful for validating that the bitpacking worked correctly.
-                        // if (offset > displayio_area_size(area)) {
-                        //     asm("bkpt");
-                        // }
-                    }
-                    uint8_t shift = (offset % pixels_per_byte) * colorspace->depth;
-                    if (colorspace->reverse_pixels_in_byte) {
-                        // Reverse the shift by subtracting it from the leftmost shift.
-                        shift = (pixels_per_byte - 1) * colorspace->depth - shift;
-                    }
-                    ((uint8_t *)buffer)[offset / pixels_per_byte] |= output_pixel.pixel << shift;
-                }
+            }
+        }
+    }
+
+    if (opaque) {
+        if (full_coverage) {
+            displayio_area_mask_set(mask, 0, displayio_area_size(area));
+        } else {
+            uint16_t overlap_width = displayio_area_width(&overlap);
+            for (int16_t y = overlap.y1; y < overlap.y2; y++) {
+                displayio_area_mask_set(mask, (y - area->y1) * fill.area_width + (overlap.x1 - area->x1), overlap_width);
             }
         }
     }
@@ -618,6 +818,10 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
         displayio_area_copy(&self->current_area, &self->previous_area);
     }
 
+    if (self->dirty_tiles != NULL && self->partial_change) {
+        uint32_t total_tiles = self->width_in_tiles * self->height_in_tiles;
+        memset(self->dirty_tiles, 0, ((total_tiles + 31) / 32) * sizeof(uint32_t));
+    }
     self->moved = false;
     self->full_change = false;
     self->partial_change = false;
@@ -636,6 +840,105 @@ void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
     // That way they won't change during a refresh and tear.
 }
 
+// Converts an area relative to the grid's pixels into absolute screen coordinates.
+static void _make_dirty_area_absolute(displayio_tilegrid_t *self, displayio_area_t *area) {
+    int16_t x = self->x;
+    int16_t y = self->y;
+    if (self->absolute_transform->transpose_xy) {
+        int16_t temp = y;
+        y = x;
+        x = temp;
+    }
+    int16_t x1 = area->x1;
+    int16_t x2 = area->x2;
+    if (self->flip_x) {
+        x1 = self->pixel_width - x1;
+        x2 = self->pixel_width - x2;
+    }
+    int16_t y1 = area->y1;
+    int16_t y2 = area->y2;
+    if (self->flip_y) {
+        y1 = self->pixel_height - y1;
+        y2 = self->pixel_height - y2;
+    }
+    if (self->transpose_xy != self->absolute_transform->transpose_xy) {
+        int16_t temp1 = y1, temp2 = y2;
+        y1 = x1;
+        x1 = temp1;
+        y2 = x2;
+        x2 = temp2;
+    }
+    area->x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
+    area->y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
+    area->x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
+    area->y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
+    if (area->y2 < area->y1) {
+        int16_t temp = area->y2;
+        area->y2 = area->y1;
+        area->y1 = temp;
+    }
+    if (area->x2 < area->x1) {
+        int16_t temp = area->x2;
+        area->x2 = area->x1;
+        area->x1 = temp;
+    }
+}
+
+// Builds refresh areas from runs of changed tiles in each row, extending runs that line up
+// with one in the row above. Returns NULL if there are too many to track separately.
+static displayio_area_t *_get_dirty_tile_areas(displayio_tilegrid_t *self, displayio_area_t *tail) {
+    displayio_area_t *areas = self->dirty_tile_areas;
+    uint16_t count = 0;
+    for (uint16_t ty = 0; ty < self->height_in_tiles; ty++) {
+        uint32_t row_start = ty * self->width_in_tiles;
+        uint16_t tx = 0;
+        while (tx < self->width_in_tiles) {
+            uint32_t index = row_start + tx;
+            if ((self->dirty_tiles[index / 32] & (1u << (index % 32))) == 0) {
+                tx++;
+                continue;
+            }
+            uint16_t run_start = tx;
+            do {
+                tx++;
+                index++;
+            } while (tx < self->width_in_tiles && (self->dirty_tiles[index / 32] & (1u << (index % 32))) != 0);
+
+            bool extended = false;
+            for (uint16_t i = 0; i < count; i++) {
+                if (areas[i].x1 == run_start && areas[i].x2 == tx && areas[i].y2 == ty) {
+                    areas[i].y2 = ty + 1;
+                    extended = true;
+                    break;
+                }
+            }
+            if (extended) {
+                continue;
+            }
+            if (count == DISPLAYIO_TILEGRID_DIRTY_TILE_AREA_COUNT) {
+                return NULL;
+            }
+            areas[count].x1 = run_start;
+            areas[count].y1 = ty;
+            areas[count].x2 = tx;
+            areas[count].y2 = ty + 1;
+            count++;
+        }
+    }
+    if (count == 0) {
+        return NULL;
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        areas[i].x1 *= self->tile_width;
+        areas[i].x2 *= self->tile_width;
+        areas[i].y1 *= self->tile_height;
+        areas[i].y2 *= self->tile_height;
+        _make_dirty_area_absolute(self, &areas[i]);
+        areas[i].next = i + 1 < count ? &areas[i + 1] : tail;
+    }
+    return areas;
+}
+
 displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_t *tail) {
     bool first_draw = self->previous_area.x1 == self->previous_area.x2;
     bool hidden = self->hidden || self->hidden_by_parent;
@@ -660,6 +963,7 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
     }
 
     // If we have an in-memory bitmap, then check it for modifications.
+    bool bitmap_changed = false;
     if (mp_obj_is_type(self->bitmap, &displayio_bitmap_type)) {
         displayio_area_t *refresh_area = displayio_bitmap_get_refresh_areas(self->bitmap, tail);
         if (refresh_area != tail) {
@@ -668,6 +972,7 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
             if (self->tiles_in_bitmap == 1) {
                 displayio_area_copy(refresh_area, &self->dirty_area);
                 self->partial_change = true;
+                bitmap_changed = true;
             } else {
                 self->full_change = true;
             }
@@ -686,47 +991,13 @@ displayio_area_t *displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *sel
     }
 
     if (self->partial_change) {
-        int16_t x = self->x;
-        int16_t y = self->y;
-        if (self->absolute_transform->transpose_xy) {
-            int16_t temp = y;
-            y = x;
-            x = temp;
-        }
-        int16_t x1 = self->dirty_area.x1;
-        int16_t x2 = self->dirty_area.x2;
-        if (self->flip_x) {
-            x1 = self->pixel_width - x1;
-            x2 = self->pixel_width - x2;
-        }
-        int16_t y1 = self->dirty_area.y1;
-        int16_t y2 = self->dirty_area.y2;
-        if (self->flip_y) {
-            y1 = self->pixel_height - y1;
-            y2 = self->pixel_height - y2;
-        }
-        if (self->transpose_xy != self->absolute_transform->transpose_xy) {
-            int16_t temp1 = y1, temp2 = y2;
-            y1 = x1;
-            x1 = temp1;
-            y2 = x2;
-            x2 = temp2;
-        }
-        self->dirty_area.x1 = self->absolute_transform->x + self->absolute_transform->dx * (x + x1);
-        self->dirty_area.y1 = self->absolute_transform->y + self->absolute_transform->dy * (y + y1);
-        self->dirty_area.x2 = self->absolute_transform->x + self->absolute_transform->dx * (x + x2);
-        self->dirty_area.y2 = self->absolute_transform->y + self->absolute_transform->dy * (y + y2);
-        if (self->dirty_area.y2 < self->dirty_area.y1) {
-            int16_t temp = self->dirty_area.y2;
-            self->dirty_area.y2 = self->dirty_area.y1;
-            self->dirty_area.y1 = temp;
-        }
-        if (self->dirty_area.x2 < self->dirty_area.x1) {
-            int16_t temp = self->dirty_area.x2;
-            self->dirty_area.x2 = self->dirty_area.x1;
-            self->dirty_area.x1 = temp;
+        if (self->dirty_tiles != NULL && !bitmap_changed) {
+            displayio_area_t *tile_areas = _get_dirty_tile_areas(self, tail);
+            if (tile_areas != NULL) {
+                return tile_areas;
+            }
         }
-
+        _make_dirty_area_absolute(self, &self->dirty_area);
         self->dirty_area.next = tail;
         return &self->dirty_area;
     }
@@ -13,6 +13,12 @@
 #include "shared-module/displayio/area.h"
 #include "shared-module/displayio/Palette.h"
 
+// Grids with at least this many tiles track which tiles changed so scattered changes don't
+// refresh everything between them.
+#define DISPLAYIO_TILEGRID_DIRTY_TILES_MIN (64)
+// Most refresh areas built from changed tiles before falling back to their bounding box.
+#define DISPLAYIO_TILEGRID_DIRTY_TILE_AREA_COUNT (8)
+
 typedef struct {
     mp_obj_base_t base;
     mp_obj_t bitmap;
@@ -31,6 +37,10 @@ typedef struct {
     uint16_t top_left_x;
     uint16_t top_left_y;
     void *tiles;  // Can be either uint8_t* or uint16_t* depending on tiles_in_bitmap
+    // One bit per on screen tile position that changed since the last refresh. NULL when only
+    // dirty_area is tracked.
+    uint32_t *dirty_tiles;
+    displayio_area_t *dirty_tile_areas; // Refresh areas built from dirty_tiles.
     const displayio_buffer_transform_t *absolute_transform;
     displayio_area_t dirty_area; // Stored as a relative area until the refresh area is fetched.
     displayio_area_t previous_area; // Stored as an absolute area.
@@ -139,3 +139,115 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
         transformed->x1 = whole->x1 + (y1 - whole->y1);
     }
 }
+
+// Pushing an area costs its pixels plus overhead for the commands that start it.
+static uint32_t _area_cost(const displayio_area_t *area, uint32_t overhead) {
+    return displayio_area_size(area) + overhead;
+}
+
+// Copies the linked list of areas clipped to whole into merged and combines them wherever one
+// bigger rectangle is cheaper to refresh than two smaller ones. If the areas don't fit in
+// merged_count, the pairs that grow the least are combined. Collapses to whole when refreshing
+// it is no more expensive. Returns the merged list or NULL if nothing is in whole.
+const displayio_area_t *displayio_area_merge(const displayio_area_t *areas, const displayio_area_t *whole,
+    uint32_t overhead, displayio_area_t *merged, uint16_t merged_count) {
+    uint16_t count = 0;
+    for (const displayio_area_t *area = areas; area != NULL; area = area->next) {
+        displayio_area_t clipped;
+        if (!displayio_area_compute_overlap(area, whole, &clipped)) {
+            continue;
+        }
+        if (count < merged_count) {
+            displayio_area_copy(&clipped, &merged[count]);
+            count++;
+            continue;
+        }
+        // Out of space so add it to the area it grows the least.
+        uint16_t best = 0;
+        uint32_t best_growth = UINT32_MAX;
+        for (uint16_t i = 0; i < count; i++) {
+            displayio_area_t u;
+            displayio_area_union(&merged[i], &clipped, &u);
+            uint32_t growth = displayio_area_size(&u) - displayio_area_size(&merged[i]);
+            if (growth < best_growth) {
+                best = i;
+                best_growth = growth;
+            }
+        }
+        displayio_area_union(&merged[best], &clipped, &merged[best]);
+    }
+    if (count == 0) {
+        return NULL;
+    }
+
+    // Combine pairs until no union is cheaper than the two areas it covers. Overlapping areas
+    // count their shared pixels twice because both refreshes push them.
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (uint16_t i = 0; i < count; i++) {
+            for (uint16_t j = i + 1; j < count; j++) {
+                displayio_area_t u;
+                displayio_area_union(&merged[i], &merged[j], &u);
+                if (_area_cost(&u, overhead) <= _area_cost(&merged[i], overhead) + _area_cost(&merged[j], overhead)) {
+                    displayio_area_copy(&u, &merged[i]);
+                    count--;
+                    displayio_area_copy(&merged[count], &merged[j]);
+                    changed = true;
+                    // Recheck everything against the bigger area.
+                    j = i;
+                }
+            }
+        }
+    }
+
+    uint32_t total_cost = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        total_cost += _area_cost(&merged[i], overhead);
+    }
+    if (total_cost >= _area_cost(whole, overhead)) {
+        displayio_area_copy(whole, &merged[0]);
+        count = 1;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        merged[i].next = i + 1 < count ? &merged[i + 1] : NULL;
+    }
+    return merged;
+}
+
+// Sets count bits starting at bit start a word at a time.
+void displayio_area_mask_set(uint32_t *mask, uint32_t start, uint32_t count) {
+    uint32_t end = start + count;
+    while (start < end) {
+        uint32_t bit = start % 32;
+        uint32_t bits = MIN(32 - bit, end - start);
+        uint32_t word_mask = 0xffffffff;
+        if (bits < 32) {
+            word_mask = ((1u << bits) - 1) << bit;
+        }
+        mask[start / 32] |= word_mask;
+        start += bits;
+    }
+}
+
+bool displayio_area_mask_all_clear(const uint32_t *mask, uint32_t count) {
+    for (uint32_t i = 0; i < count / 32; i++) {
+        if (mask[i] != 0) {
+            return false;
+        }
+    }
+    uint32_t remaining = count % 32;
+    return remaining == 0 || (mask[count / 32] & ((1u << remaining) - 1)) == 0;
+}
+
+bool displayio_area_mask_all_set(const uint32_t *mask, uint32_t count) {
+    for (uint32_t i = 0; i < count / 32; i++) {
+        if (mask[i] != 0xffffffff) {
+            return false;
+        }
+    }
+    uint32_t remaining = count % 32;
+    uint32_t tail = (1u << remaining) - 1;
+    return remaining == 0 || (mask[count / 32] & tail) == tail;
+}
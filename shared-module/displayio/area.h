@@ -55,3 +55,11 @@ void displayio_area_transform_within(bool mirror_x, bool mirror_y, bool transpos
     const displayio_area_t *original,
     const displayio_area_t *whole,
     displayio_area_t *transformed);
+
+const displayio_area_t *displayio_area_merge(const displayio_area_t *areas, const displayio_area_t *whole,
+    uint32_t overhead, displayio_area_t *merged, uint16_t merged_count);
+
+// Fill masks have one bit per pixel of an area's buffer, set once the pixel has been drawn.
+void displayio_area_mask_set(uint32_t *mask, uint32_t start, uint32_t count);
+bool displayio_area_mask_all_clear(const uint32_t *mask, uint32_t count);
+bool displayio_area_mask_all_set(const uint32_t *mask, uint32_t count);
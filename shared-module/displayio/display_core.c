@@ -203,3 +203,17 @@ bool displayio_display_core_clip_area(displayio_display_core_t *self, const disp
     }
     return true;
 }
+
+// Returns the areas that need refreshing. Overlapping and nearby areas are merged when that is
+// cheaper given area_overhead, the cost of starting an area in pixels.
+const displayio_area_t *displayio_display_core_get_refresh_areas(displayio_display_core_t *self, uint32_t area_overhead) {
+    if (self->full_refresh) {
+        self->area.next = NULL;
+        return &self->area;
+    } else if (self->current_group != NULL) {
+        const displayio_area_t *areas = displayio_group_get_refresh_areas(self->current_group, NULL);
+        return displayio_area_merge(areas, &self->area, area_overhead,
+            self->refresh_areas, DISPLAYIO_REFRESH_AREA_COUNT);
+    }
+    return NULL;
+}
@@ -13,11 +13,15 @@
 
 #define NO_COMMAND 0x100
 
+// Most areas a refresh is merged down to.
+#define DISPLAYIO_REFRESH_AREA_COUNT (8)
+
 typedef struct {
     displayio_group_t *current_group;
     uint64_t last_refresh;
     displayio_buffer_transform_t transform;
     displayio_area_t area;
+    displayio_area_t refresh_areas[DISPLAYIO_REFRESH_AREA_COUNT];
     uint16_t width;
     uint16_t height;
     uint16_t rotation;
@@ -51,3 +55,5 @@ void displayio_display_core_collect_ptrs(displayio_display_core_t *self);
 bool displayio_display_core_fill_area(displayio_display_core_t *self, displayio_area_t *area, uint32_t *mask, uint32_t *buffer);
 
 bool displayio_display_core_clip_area(displayio_display_core_t *self, const displayio_area_t *area, displayio_area_t *clipped);
+
+const displayio_area_t *displayio_display_core_get_refresh_areas(displayio_display_core_t *self, uint32_t area_overhead);
@@ -0,0 +1,160 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#include "shared-module/displayio/polygon.h"
+
+#include <stdbool.h>
+
+#include "py/misc.h"
+
+// Division that rounds toward negative infinity. d must be positive.
+static int64_t floor_div(int64_t n, int32_t d) {
+    int64_t q = n / d;
+    if (n % d != 0 && n < 0) {
+        q--;
+    }
+    return q;
+}
+
+size_t displayio_polygon_buffer_size(uint16_t point_count) {
+    // Column scans can produce two crossings per edge and each crossing ends at most one span.
+    return point_count * (sizeof(displayio_polygon_edge_t) + sizeof(uint16_t) +
+        2 * sizeof(displayio_polygon_crossing_t) + 2 * sizeof(int16_t));
+}
+
+void displayio_polygon_init(displayio_polygon_t *self, const int16_t *points, uint16_t point_count, void *buffer) {
+    self->edges = buffer;
+    self->crossings = (displayio_polygon_crossing_t *)(self->edges + point_count);
+    self->active = (uint16_t *)(self->crossings + 2 * point_count);
+    self->spans = (int16_t *)(self->active + point_count);
+    self->edge_count = 0;
+    self->active_count = 0;
+    self->next_edge = 0;
+    self->row = INT16_MIN;
+
+    for (uint16_t i = 0; i < point_count; i++) {
+        const int16_t *start = &points[2 * i];
+        const int16_t *end = &points[2 * ((i + 1) % point_count)];
+        if (start[1] == end[1]) {
+            // Horizontal edges never cross a row.
+            continue;
+        }
+        displayio_polygon_edge_t edge;
+        if (start[1] < end[1]) {
+            edge = (displayio_polygon_edge_t) {start[0], start[1], end[0], end[1], 1};
+        } else {
+            edge = (displayio_polygon_edge_t) {end[0], end[1], start[0], start[1], -1};
+        }
+        // Insertion sort by top row. Outlines tend to be mostly in order already.
+        uint16_t j = self->edge_count;
+        while (j > 0 && self->edges[j - 1].y1 > edge.y1) {
+            self->edges[j] = self->edges[j - 1];
+            j--;
+        }
+        self->edges[j] = edge;
+        self->edge_count++;
+    }
+}
+
+// Sorts the crossings by position and turns them into [start, end) spans where the winding
+// number starting from initial_winding isn't zero.
+static uint16_t _crossings_to_spans(displayio_polygon_t *self, uint16_t count, int16_t initial_winding, const int16_t **spans) {
+    displayio_polygon_crossing_t *crossings = self->crossings;
+    for (uint16_t i = 1; i < count; i++) {
+        displayio_polygon_crossing_t crossing = crossings[i];
+        uint16_t j = i;
+        while (j > 0 && crossings[j - 1].position > crossing.position) {
+            crossings[j] = crossings[j - 1];
+            j--;
+        }
+        crossings[j] = crossing;
+    }
+
+    uint16_t span_count = 0;
+    int16_t winding = initial_winding;
+    for (uint16_t i = 0; i < count;) {
+        int16_t position = crossings[i].position;
+        bool was_inside = winding != 0;
+        // Apply every crossing at this position before checking the winding.
+        for (; i < count && crossings[i].position == position; i++) {
+            winding += crossings[i].winding;
+        }
+        bool inside = winding != 0;
+        if (inside && !was_inside) {
+            self->spans[2 * span_count] = position;
+        } else if (!inside && was_inside) {
+            self->spans[2 * span_count + 1] = position;
+            span_count++;
+        }
+    }
+    *spans = self->spans;
+    return span_count;
+}
+
+uint16_t displayio_polygon_get_row_spans(displayio_polygon_t *self, int16_t y, const int16_t **spans) {
+    if (y < self->row) {
+        // Start over when going back up.
+        self->active_count = 0;
+        self->next_edge = 0;
+    }
+    self->row = y;
+
+    // Drop the edges that ended above this row and add the ones that start on or above it.
+    uint16_t active_count = 0;
+    for (uint16_t i = 0; i < self->active_count; i++) {
+        if (self->edges[self->active[i]].y2 > y) {
+            self->active[active_count++] = self->active[i];
+        }
+    }
+    while (self->next_edge < self->edge_count && self->edges[self->next_edge].y1 <= y) {
+        if (self->edges[self->next_edge].y2 > y) {
+            self->active[active_count++] = self->next_edge;
+        }
+        self->next_edge++;
+    }
+    self->active_count = active_count;
+
+    // Each edge counts for the pixels left of where it crosses the row so the winding number
+    // starts as the sum of all of them.
+    int16_t initial_winding = 0;
+    for (uint16_t i = 0; i < active_count; i++) {
+        const displayio_polygon_edge_t *edge = &self->edges[self->active[i]];
+        int32_t dy = edge->y2 - edge->y1;
+        // Products of two coordinate differences can overflow 32 bits.
+        int64_t n = (int64_t)(y - edge->y1) * (edge->x2 - edge->x1);
+        // First pixel to the right of the crossing, which is x1 + ceil(n / dy).
+        self->crossings[i].position = edge->x1 - floor_div(-n, dy);
+        self->crossings[i].winding = -edge->winding;
+        initial_winding += edge->winding;
+    }
+    return _crossings_to_spans(self, active_count, initial_winding, spans);
+}
+
+uint16_t displayio_polygon_get_column_spans(displayio_polygon_t *self, int16_t x, const int16_t **spans) {
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < self->edge_count; i++) {
+        const displayio_polygon_edge_t *edge = &self->edges[i];
+        // An edge counts for the rows where it crosses to the right of x.
+        int32_t dx = edge->x2 - edge->x1;
+        int32_t dy = edge->y2 - edge->y1;
+        int64_t n = (int64_t)(x - edge->x1) * dy;
+        int64_t start = edge->y1;
+        int64_t end = edge->y2;
+        if (dx > 0) {
+            start = MAX(start, edge->y1 + floor_div(n, dx) + 1);
+        } else if (dx < 0) {
+            end = MIN(end, edge->y1 - floor_div(n, -dx));
+        } else if (x >= edge->x1) {
+            continue;
+        }
+        if (start >= end) {
+            continue;
+        }
+        self->crossings[count++] = (displayio_polygon_crossing_t) {(int16_t)start, edge->winding};
+        self->crossings[count++] = (displayio_polygon_crossing_t) {(int16_t)end, -edge->winding};
+    }
+    return _crossings_to_spans(self, count, 0, spans);
+}
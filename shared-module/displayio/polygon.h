@@ -0,0 +1,55 @@
+// This file is part of the CircuitPython project: https://circuitpython.org
+//
+// SPDX-FileCopyrightText: Copyright (c) 2026 Adafruit Industries LLC
+//
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Scanline rasterizer for filled polygons shared by bitmaptools and vectorio. A pixel is inside
+// when its winding number is non-zero. Edges include their top row but not their bottom row and
+// pixels exactly on the right side of an edge are outside.
+
+// Implementations are in polygon.c
+typedef struct {
+    int16_t x1; // Top end.
+    int16_t y1;
+    int16_t x2; // Bottom end. y2 is always greater than y1.
+    int16_t y2;
+    int16_t winding; // 1 when the edge originally pointed down and -1 when it pointed up.
+} displayio_polygon_edge_t;
+
+typedef struct {
+    int16_t position;
+    int16_t winding;
+} displayio_polygon_crossing_t;
+
+typedef struct {
+    displayio_polygon_edge_t *edges; // Sorted by y1.
+    uint16_t *active; // Indices of the edges that cross the last row scanned.
+    displayio_polygon_crossing_t *crossings;
+    int16_t *spans;
+    uint16_t edge_count;
+    uint16_t active_count;
+    uint16_t next_edge; // First edge that starts below the last row scanned.
+    int16_t row;
+} displayio_polygon_t;
+
+// Returns the size of the buffer needed for a polygon with point_count points.
+size_t displayio_polygon_buffer_size(uint16_t point_count);
+
+// Builds the edge table for the closed polygon through the x, y pairs in points. buffer must be
+// displayio_polygon_buffer_size() bytes and aligned for int16_t. points isn't used afterwards.
+void displayio_polygon_init(displayio_polygon_t *self, const int16_t *points, uint16_t point_count, void *buffer);
+
+// Finds the runs of pixels inside the polygon on row y. Runs are stored as [start, end) pairs of x
+// in *spans and the number of runs is returned. Rows scanned in increasing order only update the
+// active edges.
+uint16_t displayio_polygon_get_row_spans(displayio_polygon_t *self, int16_t y, const int16_t **spans);
+
+// Finds the runs of pixels inside the polygon in column x. Runs are stored as [start, end) pairs
+// of y in *spans and the number of runs is returned.
+uint16_t displayio_polygon_get_column_spans(displayio_polygon_t *self, int16_t x, const int16_t **spans);
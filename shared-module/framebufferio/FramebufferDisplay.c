@@ -105,14 +105,11 @@ mp_obj_t common_hal_framebufferio_framebufferdisplay_get_framebuffer(framebuffer
     return self->framebuffer;
 }
 
+// Areas are copied straight into the framebuffer so starting one costs little.
+#define AREA_OVERHEAD_PIXELS (16)
+
 static const displayio_area_t *_get_refresh_areas(framebufferio_framebufferdisplay_obj_t *self) {
-    if (self->core.full_refresh) {
-        self->core.area.next = NULL;
-        return &self->core.area;
-    } else if (self->core.current_group != NULL) {
-        return displayio_group_get_refresh_areas(self->core.current_group, NULL);
-    }
-    return NULL;
+    return displayio_display_core_get_refresh_areas(&self->core, AREA_OVERHEAD_PIXELS);
 }
 
 #define MARK_ROW_DIRTY(r) (dirty_row_bitmask[r / 8] |= (1 << (r & 7)))
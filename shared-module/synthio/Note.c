@@ -102,6 +102,22 @@ void common_hal_synthio_note_set_waveform(synthio_note_obj_t *self, mp_obj_t wav
         self->waveform_buf = bufinfo_waveform;
     }
     self->waveform_obj = waveform_in;
+    // rebuild even if it's the same buffer, since its content may have changed
+    self->mipmap_source = NULL;
+    if (self->waveform_buf.buf) {
+        synthio_note_update_mipmap(self, &self->waveform_buf);
+    }
+}
+
+bool common_hal_synthio_note_get_bandlimited(synthio_note_obj_t *self) {
+    return self->bandlimited;
+}
+
+void common_hal_synthio_note_set_bandlimited(synthio_note_obj_t *self, bool value_in) {
+    self->bandlimited = value_in;
+    if (self->waveform_buf.buf) {
+        synthio_note_update_mipmap(self, &self->waveform_buf);
+    }
 }
 
 mp_obj_t common_hal_synthio_note_get_waveform_loop_start(synthio_note_obj_t *self) {
@@ -162,9 +178,34 @@ void synthio_note_recalculate(synthio_note_obj_t *self, int32_t sample_rate) {
     }
 }
 
-void synthio_note_start(synthio_note_obj_t *self, int32_t sample_rate) {
+void synthio_note_update_mipmap(synthio_note_obj_t *self, const mp_buffer_info_t *waveform) {
+    if (!self->bandlimited) {
+        self->mipmap_source = NULL;
+        self->mipmap = NULL;
+        self->mipmap_levels = 0;
+        return;
+    }
+    if (self->mipmap_source == waveform->buf && self->mipmap_source_len == waveform->len) {
+        return;
+    }
+    uint8_t levels;
+    size_t size = synthio_mipmap_size(waveform->len, &levels);
+    // the old copies may still be in use by the synthesizer until this point
+    self->mipmap_source = NULL;
+    self->mipmap_levels = 0;
+    self->mipmap = size ? m_malloc_without_collect(size * sizeof(int16_t)) : NULL;
+    if (size) {
+        synthio_mipmap_build(self->mipmap, waveform->buf, waveform->len);
+    }
+    self->mipmap_levels = levels;
+    self->mipmap_source_len = waveform->len;
+    self->mipmap_source = waveform->buf;
+}
+
+void synthio_note_start(synthio_note_obj_t *self, int32_t sample_rate, const mp_buffer_info_t *default_waveform) {
     synthio_note_recalculate(self, sample_rate);
     synthio_biquad_filter_reset(&self->filter_state);
+    synthio_note_update_mipmap(self, self->waveform_buf.buf ? &self->waveform_buf : default_waveform);
 }
 
 // Perform a pitch bend operation
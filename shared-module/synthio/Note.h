@@ -32,9 +32,16 @@ typedef struct synthio_note_obj {
     mp_buffer_info_t ring_waveform_buf;
     synthio_block_slot_t ring_waveform_loop_start, ring_waveform_loop_end;
     synthio_envelope_definition_t envelope_def;
+
+    bool bandlimited;
+    uint8_t mipmap_levels;
+    uint16_t mipmap_source_len;
+    const int16_t *mipmap_source;
+    int16_t *mipmap;
 } synthio_note_obj_t;
 
 void synthio_note_recalculate(synthio_note_obj_t *self, int32_t sample_rate);
 uint32_t synthio_note_step(synthio_note_obj_t *self, int32_t sample_rate, int16_t dur, int16_t loudness[2]);
-void synthio_note_start(synthio_note_obj_t *self, int32_t sample_rate);
+void synthio_note_update_mipmap(synthio_note_obj_t *self, const mp_buffer_info_t *waveform);
+void synthio_note_start(synthio_note_obj_t *self, int32_t sample_rate, const mp_buffer_info_t *default_waveform);
 bool synthio_note_playing(synthio_note_obj_t *self);
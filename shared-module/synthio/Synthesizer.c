@@ -15,10 +15,10 @@
 
 void common_hal_synthio_synthesizer_construct(synthio_synthesizer_obj_t *self,
     uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj,
-    mp_obj_t envelope_obj) {
+    mp_obj_t envelope_obj, mp_int_t voices, mp_int_t control_rate) {
 
-    synthio_synth_init(&self->synth, sample_rate, channel_count, waveform_obj, envelope_obj);
-    self->blocks = mp_obj_new_list(0, NULL);
+    synthio_synth_init(&self->synth, sample_rate, channel_count, waveform_obj, envelope_obj, voices, control_rate);
+    self->synth.blocks = mp_obj_new_list(0, NULL);
 }
 
 void common_hal_synthio_synthesizer_deinit(synthio_synthesizer_obj_t *self) {
@@ -41,24 +41,13 @@ audioio_get_buffer_result_t synthio_synthesizer_get_buffer(synthio_synthesizer_o
 
     synthio_synth_synthesize(&self->synth, buffer, buffer_length, single_channel_output ? channel : 0);
 
-    // free-running LFOs
-    mp_obj_iter_buf_t iter_buf;
-    mp_obj_t iterable = mp_getiter(self->blocks, &iter_buf);
-    mp_obj_t item;
-    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
-        if (!synthio_obj_is_block(item)) {
-            continue;
-        }
-        synthio_block_slot_t slot = { item };
-        (void)synthio_block_slot_get(&slot);
-    }
     return GET_BUFFER_MORE_DATA;
 }
 
 void common_hal_synthio_synthesizer_release_all(synthio_synthesizer_obj_t *self) {
-    for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
-        if (self->synth.span.note_obj[i] != SYNTHIO_SILENCE) {
-            synthio_span_change_note(&self->synth, self->synth.span.note_obj[i], SYNTHIO_SILENCE);
+    for (size_t i = 0; i < self->synth.voice_count; i++) {
+        if (self->synth.voices[i].note_obj != SYNTHIO_SILENCE) {
+            synthio_span_change_note(&self->synth, self->synth.voices[i].note_obj, SYNTHIO_SILENCE);
         }
     }
 }
@@ -97,7 +86,7 @@ void common_hal_synthio_synthesizer_press(synthio_synthesizer_obj_t *self, mp_ob
     if (is_note(to_press)) {
         if (!mp_obj_is_small_int(to_press)) {
             synthio_note_obj_t *note = MP_OBJ_TO_PTR(to_press);
-            synthio_note_start(note, self->synth.base.sample_rate);
+            synthio_note_start(note, self->synth.base.sample_rate, &self->synth.waveform_bufinfo);
         }
         synthio_span_change_note(&self->synth, SYNTHIO_SILENCE, validate_note(to_press));
         return;
@@ -110,7 +99,7 @@ void common_hal_synthio_synthesizer_press(synthio_synthesizer_obj_t *self, mp_ob
         note_obj = validate_note(note_obj);
         if (!mp_obj_is_small_int(note_obj)) {
             synthio_note_obj_t *note = MP_OBJ_TO_PTR(note_obj);
-            synthio_note_start(note, self->synth.base.sample_rate);
+            synthio_note_start(note, self->synth.base.sample_rate, &self->synth.waveform_bufinfo);
         }
         synthio_span_change_note(&self->synth, SYNTHIO_SILENCE, note_obj);
     }
@@ -134,31 +123,47 @@ void common_hal_synthio_synthesizer_retrigger(synthio_synthesizer_obj_t *self, m
 
 mp_obj_t common_hal_synthio_synthesizer_get_pressed_notes(synthio_synthesizer_obj_t *self) {
     int count = 0;
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
-        if (self->synth.span.note_obj[chan] != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
+    for (int chan = 0; chan < self->synth.voice_count; chan++) {
+        if (self->synth.voices[chan].note_obj != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
             count += 1;
         }
     }
     mp_obj_tuple_t *result = MP_OBJ_TO_PTR(mp_obj_new_tuple(count, NULL));
-    for (size_t chan = 0, j = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
-        if (self->synth.span.note_obj[chan] != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
-            result->items[j++] = self->synth.span.note_obj[chan];
+    for (size_t chan = 0, j = 0; chan < self->synth.voice_count; chan++) {
+        if (self->synth.voices[chan].note_obj != SYNTHIO_SILENCE && SYNTHIO_NOTE_IS_PLAYING(&self->synth, chan)) {
+            result->items[j++] = self->synth.voices[chan].note_obj;
         }
     }
     return MP_OBJ_FROM_PTR(result);
 }
 
 envelope_state_e common_hal_synthio_synthesizer_note_info(synthio_synthesizer_obj_t *self, mp_obj_t note, mp_float_t *vol_out) {
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
-        if (self->synth.span.note_obj[chan] == note) {
-            *vol_out = self->synth.envelope_state[chan].level / 32767.;
-            return self->synth.envelope_state[chan].state;
+    for (int chan = 0; chan < self->synth.voice_count; chan++) {
+        if (self->synth.voices[chan].note_obj == note) {
+            *vol_out = self->synth.voices[chan].envelope_state.level / 32767.;
+            return self->synth.voices[chan].envelope_state.state;
         }
     }
     return (envelope_state_e) - 1;
 }
 
+mp_int_t common_hal_synthio_synthesizer_get_voices(synthio_synthesizer_obj_t *self) {
+    return self->synth.voice_count;
+}
+
+synthio_voice_stealing_t common_hal_synthio_synthesizer_get_voice_stealing(synthio_synthesizer_obj_t *self) {
+    return self->synth.voice_stealing;
+}
+
+void common_hal_synthio_synthesizer_set_voice_stealing(synthio_synthesizer_obj_t *self, synthio_voice_stealing_t value) {
+    self->synth.voice_stealing = value;
+}
+
+mp_int_t common_hal_synthio_synthesizer_get_control_rate(synthio_synthesizer_obj_t *self) {
+    return self->synth.control_rate;
+}
+
 
 mp_obj_t common_hal_synthio_synthesizer_get_blocks(synthio_synthesizer_obj_t *self) {
-    return self->blocks;
+    return self->synth.blocks;
 }
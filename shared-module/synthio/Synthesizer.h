@@ -13,7 +13,6 @@
 
 typedef struct {
     synthio_synth_t synth;
-    mp_obj_t blocks;
 } synthio_synthesizer_obj_t;
 
 
@@ -14,6 +14,10 @@
 #include <math.h>
 #include <stdlib.h>
 
+#if defined(__arm__) && __arm__
+#include "cmsis_compiler.h"
+#endif
+
 #define MP_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
 
 mp_float_t synthio_global_rate_scale, synthio_global_W_scale;
@@ -125,6 +129,27 @@ static void synthio_envelope_state_step(synthio_envelope_state_t *state, synthio
     }
 }
 
+// The envelope level between two steps of synthio_envelope_state_step, as if
+// the level moved continuously instead of once every SYNTHIO_MAX_DUR samples
+static int16_t synthio_envelope_state_interpolate(const synthio_envelope_state_t *state, const synthio_envelope_definition_t *def) {
+    int32_t level = state->level;
+    int32_t substep = state->substep;
+    switch (state->state) {
+        case SYNTHIO_ENVELOPE_STATE_SUSTAIN:
+            break;
+        case SYNTHIO_ENVELOPE_STATE_ATTACK:
+            level = MIN(level + def->attack_step * substep / SYNTHIO_MAX_DUR, def->attack_level);
+            break;
+        case SYNTHIO_ENVELOPE_STATE_DECAY:
+            level = MAX(level + def->decay_step * substep / SYNTHIO_MAX_DUR, def->sustain_level);
+            break;
+        case SYNTHIO_ENVELOPE_STATE_RELEASE:
+            level = MAX(level + def->release_step * substep / SYNTHIO_MAX_DUR, 0);
+            break;
+    }
+    return level;
+}
+
 static void synthio_envelope_state_init(synthio_envelope_state_t *state, synthio_envelope_definition_t *def) {
     state->level = 0;
     state->substep = 0;
@@ -171,8 +196,38 @@ int16_t synthio_mix_down_sample(int32_t sample, int32_t scale) {
     return sample;
 }
 
+// Linearly interpolate a sample from a looped waveform. phase is a fraction
+// of one cycle of the waveform, with 2^32 being a full cycle.
+static inline int16_t synth_interpolate_sample(const int16_t *waveform, uint32_t waveform_length, uint32_t phase) {
+    uint32_t pos = ((uint64_t)phase * waveform_length) >> 17;
+    uint32_t idx = pos >> 15;
+    uint32_t next = idx + 1;
+    if (next == waveform_length) {
+        next = 0;
+    }
+    int32_t a = waveform[idx];
+    int32_t b = waveform[next];
+    return a + (((b - a) * (int32_t)(pos & 0x7fff)) >> 15);
+}
+
+// Pick the longest band-limited copy of the note's waveform that can be played
+// at phase_rate without aliasing, i.e., stepping through at most one sample
+// of the copy for each output sample.
+static const int16_t *synth_note_mipmap_level(synthio_note_obj_t *note, const int16_t *waveform, uint32_t *waveform_length, uint32_t phase_rate) {
+    uint32_t length = *waveform_length;
+    const int16_t *next = note->mipmap;
+    for (uint8_t level = 0; level < note->mipmap_levels && (uint64_t)length * phase_rate > ((uint64_t)1 << 32); level++) {
+        waveform = next;
+        length /= 2;
+        next += length;
+    }
+    *waveform_length = length;
+    return waveform;
+}
+
 static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *out_buffer32, int16_t dur, int16_t loudness[2]) {
-    mp_obj_t note_obj = synth->span.note_obj[chan];
+    synthio_voice_t *voice = &synth->voices[chan];
+    mp_obj_t note_obj = voice->note_obj;
 
     int32_t sample_rate = synth->base.sample_rate;
 
@@ -182,6 +237,11 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
     uint32_t waveform_start = 0;
     uint32_t waveform_length = synth->waveform_bufinfo.len;
 
+    bool bandlimited = false;
+    uint32_t phase_rate = 0;
+    const int16_t *bl_waveform = NULL;
+    uint32_t bl_waveform_length = 0;
+
     uint32_t ring_dds_rate = 0;
     const int16_t *ring_waveform = NULL;
     uint32_t ring_waveform_start = 0;
@@ -207,6 +267,17 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
             waveform_length = (uint32_t)synthio_block_slot_get_limited(&note->waveform_loop_end, waveform_start + 1, waveform_length);
         }
         dds_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled * (waveform_length - waveform_start), sample_rate);
+        if (note->bandlimited) {
+            bandlimited = true;
+            phase_rate = synthio_frequency_convert_scaled_to_dds((uint64_t)frequency_scaled << 16, sample_rate);
+            bl_waveform = waveform + waveform_start;
+            bl_waveform_length = waveform_length - waveform_start;
+            // the band-limited copies only cover the whole waveform, and are
+            // only valid for the waveform they were made from
+            if (waveform_start == 0 && note->mipmap_source == waveform && note->mipmap_source_len == waveform_length) {
+                bl_waveform = synth_note_mipmap_level(note, bl_waveform, &bl_waveform_length, phase_rate);
+            }
+        }
         if (note->ring_frequency_scaled != 0 && note->ring_waveform_buf.buf) {
             ring_waveform = note->ring_waveform_buf.buf;
             ring_waveform_length = note->ring_waveform_buf.len;
@@ -222,29 +293,39 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
 
     uint32_t offset = waveform_start << SYNTHIO_FREQUENCY_SHIFT;
     uint32_t lim = waveform_length << SYNTHIO_FREQUENCY_SHIFT;
-    uint32_t accum = synth->accum[chan];
+    uint32_t accum = voice->accum;
 
     if (dds_rate > lim / 2) {
         // beyond nyquist, can't play note
         return false;
     }
 
-    // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
-    if (accum > lim) {
-        accum = accum % lim + offset;
-    }
-
-    // first, fill with waveform
-    for (uint16_t i = 0; i < dur; i++) {
-        accum += dds_rate;
-        // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+    if (bandlimited) {
+        // accum holds the phase as a fraction of a cycle, so that it carries
+        // over when a different band-limited copy is selected
+        for (uint16_t i = 0; i < dur; i++) {
+            accum += phase_rate;
+            out_buffer32[i] = synth_interpolate_sample(bl_waveform, bl_waveform_length, accum);
+        }
+        voice->accum = accum;
+    } else {
+        // can happen if note waveform gets set mid-note, but the expensive modulo is usually avoided
         if (accum > lim) {
-            accum = accum - lim + offset;
+            accum = accum % lim + offset;
+        }
+
+        // first, fill with waveform
+        for (uint16_t i = 0; i < dur; i++) {
+            accum += dds_rate;
+            // because dds_rate is low enough, the subtraction is guaranteed to go back into range, no expensive modulo needed
+            if (accum > lim) {
+                accum = accum - lim + offset;
+            }
+            int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
+            out_buffer32[i] = waveform[idx];
         }
-        int16_t idx = accum >> SYNTHIO_FREQUENCY_SHIFT;
-        out_buffer32[i] = waveform[idx];
+        voice->accum = accum;
     }
-    synth->accum[chan] = accum;
 
     if (ring_dds_rate) {
         if (ring_dds_rate > lim / 2) {
@@ -254,7 +335,7 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
         }
 
         // now modulate by ring and accumulate
-        accum = synth->ring_accum[chan];
+        accum = voice->ring_accum;
         offset = ring_waveform_start << SYNTHIO_FREQUENCY_SHIFT;
         lim = ring_waveform_length << SYNTHIO_FREQUENCY_SHIFT;
 
@@ -273,7 +354,7 @@ static bool synth_note_into_buffer(synthio_synth_t *synth, int chan, int32_t *ou
             int16_t wi = (ring_waveform[idx] * out_buffer32[i]) / 32768; // consider for synthio_sat16 but had a weird artificat
             out_buffer32[i] = wi;
         }
-        synth->ring_accum[chan] = accum;
+        voice->ring_accum = accum;
     }
     return true;
 }
@@ -289,57 +370,103 @@ static mp_obj_t synthio_synth_get_note_filter(mp_obj_t note_obj) {
     return mp_const_none;
 }
 
-static void sum_with_loudness(int32_t *out_buffer32, int32_t *tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
+// Scale a voice sample by its loudness, exactly as synthio_sat16(sample * loudness, 16)
+// would, but without branches, so that the loops below can be vectorized.
+static inline int32_t scale_by_loudness(int32_t sample, int32_t loudness) {
+    int32_t n = sample * loudness;
+    n = (n + ((n >> 31) & 0xffff)) >> 16;
+    #if (defined(__ARM_ARCH_7EM__) && (__ARM_ARCH_7EM__ == 1))
+    return __SSAT(n, 16);
+    #else
+    return MIN(MAX(n, -32768), 32767);
+    #endif
+}
+
+static void sum_with_loudness(int32_t *restrict out_buffer32, const int32_t *restrict tmp_buffer32, int16_t loudness[2], size_t dur, int synth_chan) {
+    int32_t left = loudness[0], right = loudness[1];
     if (synth_chan == 1) {
         for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += synthio_sat16((*tmp_buffer32++ *loudness[0]), 16);
+            out_buffer32[i] += scale_by_loudness(tmp_buffer32[i], left);
         }
     } else {
         for (size_t i = 0; i < dur; i++) {
-            *out_buffer32++ += synthio_sat16((*tmp_buffer32 * loudness[0]), 16);
-            *out_buffer32++ += synthio_sat16((*tmp_buffer32++ *loudness[1]), 16);
+            out_buffer32[2 * i] += scale_by_loudness(tmp_buffer32[i], left);
+            out_buffer32[2 * i + 1] += scale_by_loudness(tmp_buffer32[i], right);
         }
     }
 }
 
-void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t *buffer_length, uint8_t channel) {
-
-    if (channel == synth->other_channel) {
-        *buffer_length = synth->last_buffer_length;
-        *bufptr = (uint8_t *)(synth->buffers[synth->other_buffer_index] + channel);
-        return;
+// Like sum_with_loudness, but the loudness moves linearly from `from` to `to`
+// over the dur samples, reaching `to` on the last one
+static void sum_with_loudness_ramp(int32_t *restrict out_buffer32, const int32_t *restrict tmp_buffer32, const int16_t from[2], const int16_t to[2], size_t dur, int synth_chan) {
+    int32_t left = from[0] * 32768, right = from[1] * 32768;
+    int32_t left_step = ((to[0] - from[0]) * 32768) / (int32_t)dur;
+    int32_t right_step = ((to[1] - from[1]) * 32768) / (int32_t)dur;
+    if (synth_chan == 1) {
+        for (size_t i = 0; i < dur; i++) {
+            left += left_step;
+            out_buffer32[i] += scale_by_loudness(tmp_buffer32[i], left >> 15);
+        }
+    } else {
+        for (size_t i = 0; i < dur; i++) {
+            left += left_step;
+            right += right_step;
+            out_buffer32[2 * i] += scale_by_loudness(tmp_buffer32[i], left >> 15);
+            out_buffer32[2 * i + 1] += scale_by_loudness(tmp_buffer32[i], right >> 15);
+        }
     }
+}
 
-    shared_bindings_synthio_lfo_tick(synth->base.sample_rate, SYNTHIO_MAX_DUR);
-
-    synth->buffer_index = !synth->buffer_index;
-    synth->other_channel = 1 - channel;
-    synth->other_buffer_index = synth->buffer_index;
-
-    uint16_t dur = MIN(SYNTHIO_MAX_DUR, synth->span.dur);
-    synth->span.dur -= dur;
+static void mix_down(int16_t *restrict out_buffer16, const int32_t *restrict mix_buffer32, size_t len, int32_t scale) {
+    for (size_t i = 0; i < len; i++) {
+        out_buffer16[i] = synthio_mix_down_sample(mix_buffer32[i], scale);
+    }
+}
 
-    int32_t out_buffer32[SYNTHIO_MAX_DUR * synth->base.channel_count];
-    int32_t tmp_buffer32[SYNTHIO_MAX_DUR];
-    memset(out_buffer32, 0, synth->base.channel_count * dur * sizeof(int32_t));
+// Free-running blocks are evaluated whether or not any playing note uses them
+static void synth_tick_blocks(synthio_synth_t *synth) {
+    if (synth->blocks == MP_OBJ_NULL) {
+        return;
+    }
+    mp_obj_iter_buf_t iter_buf;
+    mp_obj_t iterable = mp_getiter(synth->blocks, &iter_buf);
+    mp_obj_t item;
+    while ((item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION) {
+        if (!synthio_obj_is_block(item)) {
+            continue;
+        }
+        synthio_block_slot_t slot = { item };
+        (void)synthio_block_slot_get(&slot);
+    }
+}
 
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
-        mp_obj_t note_obj = synth->span.note_obj[chan];
+// Render dur samples of every voice into out_buffer32, evaluating blocks,
+// filters and envelopes once
+static void synth_render_period(synthio_synth_t *synth, int32_t *out_buffer32, int32_t *tmp_buffer32, uint16_t dur) {
+    bool ramp = synth->control_rate != 0;
+    for (int chan = 0; chan < synth->voice_count; chan++) {
+        synthio_voice_t *voice = &synth->voices[chan];
+        mp_obj_t note_obj = voice->note_obj;
         if (note_obj == SYNTHIO_SILENCE) {
             continue;
         }
 
-        if (synth->envelope_state[chan].level == 0) {
+        if (voice->envelope_state.level == 0) {
             // note is truly finished, but we only just noticed
-            synth->span.note_obj[chan] = SYNTHIO_SILENCE;
+            voice->note_obj = SYNTHIO_SILENCE;
             continue;
         }
 
-        int16_t loudness[2] = {synth->envelope_state[chan].level, synth->envelope_state[chan].level};
+        int16_t level = voice->envelope_state.level;
+        if (ramp) {
+            level = synthio_envelope_state_interpolate(&voice->envelope_state, synthio_synth_get_note_envelope(synth, note_obj));
+        }
+        int16_t loudness[2] = {level, level};
 
         if (!synth_note_into_buffer(synth, chan, tmp_buffer32, dur, loudness)) {
             // for some other reason, such as being above nyquist, note
             // couldn't be synthed, so don't filter or sum it in
+            voice->loudness[0] = voice->loudness[1] = 0;
             continue;
         }
 
@@ -351,26 +478,65 @@ void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t
         }
 
         // adjust loudness by envelope
-        sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->base.channel_count);
-    }
-
-    int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
-
-    // mix down audio
-    for (size_t i = 0; i < dur * synth->base.channel_count; i++) {
-        int32_t sample = out_buffer32[i];
-        out_buffer16[i] = synthio_mix_down_sample(sample, SYNTHIO_MIX_DOWN_SCALE(CIRCUITPY_SYNTHIO_MAX_CHANNELS));
+        if (ramp && (voice->loudness[0] != loudness[0] || voice->loudness[1] != loudness[1])) {
+            sum_with_loudness_ramp(out_buffer32, tmp_buffer32, voice->loudness, loudness, dur, synth->base.channel_count);
+        } else if (loudness[0] != 0 || loudness[1] != 0) {
+            sum_with_loudness(out_buffer32, tmp_buffer32, loudness, dur, synth->base.channel_count);
+        }
+        voice->loudness[0] = loudness[0];
+        voice->loudness[1] = loudness[1];
     }
 
     // advance envelope states
-    for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
-        mp_obj_t note_obj = synth->span.note_obj[chan];
+    for (int chan = 0; chan < synth->voice_count; chan++) {
+        synthio_voice_t *voice = &synth->voices[chan];
+        mp_obj_t note_obj = voice->note_obj;
         if (note_obj == SYNTHIO_SILENCE) {
             continue;
         }
-        synthio_envelope_state_step(&synth->envelope_state[chan], synthio_synth_get_note_envelope(synth, note_obj), dur);
+        synthio_envelope_state_step(&voice->envelope_state, synthio_synth_get_note_envelope(synth, note_obj), dur);
     }
 
+    synth_tick_blocks(synth);
+}
+
+void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **bufptr, uint32_t *buffer_length, uint8_t channel) {
+
+    if (channel == synth->other_channel) {
+        *buffer_length = synth->last_buffer_length;
+        *bufptr = (uint8_t *)(synth->buffers[synth->other_buffer_index] + channel);
+        return;
+    }
+
+    synth->buffer_index = !synth->buffer_index;
+    synth->other_channel = 1 - channel;
+    synth->other_buffer_index = synth->buffer_index;
+
+    uint16_t dur = MIN(SYNTHIO_MAX_DUR, synth->span.dur);
+    synth->span.dur -= dur;
+
+    // the mix of all voices, followed by space for a single voice
+    int32_t *out_buffer32 = audiosample_scratch();
+    int32_t *tmp_buffer32 = out_buffer32 + SYNTHIO_MAX_DUR * synth->base.channel_count;
+    memset(out_buffer32, 0, synth->base.channel_count * dur * sizeof(int32_t));
+
+    if (synth->control_rate == 0) {
+        shared_bindings_synthio_lfo_tick(synth->base.sample_rate, SYNTHIO_MAX_DUR);
+        synth_render_period(synth, out_buffer32, tmp_buffer32, dur);
+    } else {
+        for (uint16_t start = 0; start < dur;) {
+            uint16_t n = MIN(synth->control_period, dur - start);
+            shared_bindings_synthio_lfo_tick(synth->base.sample_rate, n);
+            synth_render_period(synth, out_buffer32 + start * synth->base.channel_count, tmp_buffer32, n);
+            start += n;
+        }
+    }
+
+    int16_t *out_buffer16 = (int16_t *)(void *)synth->buffers[synth->buffer_index];
+
+    // mix down audio
+    mix_down(out_buffer16, out_buffer32, dur * synth->base.channel_count, SYNTHIO_MIX_DOWN_SCALE(synth->voice_count));
+
     *buffer_length = synth->last_buffer_length = dur * SYNTHIO_BYTES_PER_SAMPLE * synth->base.channel_count;
     *bufptr = (uint8_t *)out_buffer16;
 }
@@ -385,6 +551,9 @@ void synthio_synth_reset_buffer(synthio_synth_t *synth, bool single_channel_outp
 void synthio_synth_deinit(synthio_synth_t *synth) {
     synth->buffers[0] = NULL;
     synth->buffers[1] = NULL;
+    synth->voices = NULL;
+    synth->voice_count = 0;
+    synth->blocks = MP_OBJ_NULL;
     audiosample_mark_deinit(&synth->base);
 }
 
@@ -397,12 +566,21 @@ mp_obj_t synthio_synth_envelope_get(synthio_synth_t *synth) {
     return synth->envelope_obj;
 }
 
-void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope_obj) {
+void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope_obj, mp_int_t voice_count, mp_int_t control_rate) {
     synthio_synth_parse_waveform(&synth->waveform_bufinfo, waveform_obj);
     mp_arg_validate_int_range(channel_count, 1, 2, MP_QSTR_channel_count);
+    mp_arg_validate_int_range(voice_count, 1, SYNTHIO_MAX_VOICES, MP_QSTR_voices);
     synth->buffer_length = SYNTHIO_MAX_DUR * SYNTHIO_BYTES_PER_SAMPLE * channel_count;
     synth->buffers[0] = m_malloc_without_collect(synth->buffer_length);
     synth->buffers[1] = m_malloc_without_collect(synth->buffer_length);
+    audiosample_scratch_reserve(SYNTHIO_MAX_DUR * (channel_count + 1) * sizeof(int32_t));
+    synth->voices = m_new0(synthio_voice_t, voice_count);
+    synth->voice_count = voice_count;
+    synth->voice_stealing = SYNTHIO_VOICE_STEALING_NONE;
+    synth->press_count = 0;
+    synth->control_rate = control_rate;
+    synth->control_period = control_rate ? MIN(SYNTHIO_MAX_DUR, MAX(SYNTHIO_MIN_CONTROL_PERIOD, sample_rate / control_rate)) : SYNTHIO_MAX_DUR;
+    synth->blocks = MP_OBJ_NULL;
     synth->base.channel_count = channel_count;
     synth->base.single_buffer = false;
     synth->other_channel = -1;
@@ -413,8 +591,8 @@ void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channe
     synth->base.max_buffer_length = synth->buffer_length;
     synthio_synth_envelope_set(synth, envelope_obj);
 
-    for (size_t i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
-        synth->span.note_obj[i] = SYNTHIO_SILENCE;
+    for (size_t i = 0; i < synth->voice_count; i++) {
+        synth->voices[i].note_obj = SYNTHIO_SILENCE;
     }
 }
 
@@ -434,9 +612,61 @@ void synthio_synth_parse_waveform(mp_buffer_info_t *bufinfo_waveform, mp_obj_t w
     parse_common(bufinfo_waveform, waveform_obj, MP_QSTR_waveform, SYNTHIO_WAVEFORM_SIZE);
 }
 
+// Half of a symmetric 23-tap half-band lowpass filter (Kaiser window,
+// beta=6) in Q15; the centre tap is 0.5 and the even taps are zero.
+static const int16_t mipmap_halfband_taps[] = {10236, -2923, 1271, -539, 190, -43};
+
+static int16_t mipmap_halfband_filter(const int16_t *waveform, uint32_t waveform_length, uint32_t idx) {
+    int32_t acc = waveform[idx] * 16384;
+    for (size_t i = 0; i < MP_ARRAY_SIZE(mipmap_halfband_taps); i++) {
+        // the waveform is periodic, and a short one may wrap more than once
+        uint32_t d = (2 * i + 1) % waveform_length;
+        uint32_t lo = idx >= d ? idx - d : idx + waveform_length - d;
+        uint32_t hi = idx + d < waveform_length ? idx + d : idx + d - waveform_length;
+        acc += mipmap_halfband_taps[i] * (waveform[lo] + waveform[hi]);
+    }
+    return synthio_sat16(acc, 15);
+}
+
+// Band-limited copies of a waveform are stored one after the other, each
+// half the length of the one before it (rounding down), until they would be
+// shorter than SYNTHIO_MIPMAP_MIN_LENGTH. Return the total number of samples
+// and the number of copies.
+size_t synthio_mipmap_size(uint32_t waveform_length, uint8_t *levels) {
+    size_t size = 0;
+    *levels = 0;
+    for (uint32_t length = waveform_length / 2; length >= SYNTHIO_MIPMAP_MIN_LENGTH; length /= 2) {
+        size += length;
+        (*levels)++;
+    }
+    return size;
+}
+
+// Each copy is made from the previous one by filtering out the top half of
+// its spectrum and resampling it to half the length. For odd lengths, the
+// filtered waveform is linearly interpolated at the new sample points.
+void synthio_mipmap_build(int16_t *dest, const int16_t *waveform, uint32_t waveform_length) {
+    for (uint32_t length = waveform_length / 2; length >= SYNTHIO_MIPMAP_MIN_LENGTH; length /= 2) {
+        for (uint32_t i = 0; i < length; i++) {
+            uint32_t pos = (uint32_t)(((uint64_t)i * waveform_length << 15) / length);
+            uint32_t idx = pos >> 15;
+            int32_t a = mipmap_halfband_filter(waveform, waveform_length, idx);
+            uint32_t frac = pos & 0x7fff;
+            if (frac) {
+                int32_t b = mipmap_halfband_filter(waveform, waveform_length, idx + 1 == waveform_length ? 0 : idx + 1);
+                a += ((b - a) * (int32_t)frac) >> 15;
+            }
+            dest[i] = a;
+        }
+        waveform = dest;
+        waveform_length = length;
+        dest += length;
+    }
+}
+
 static int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
-    for (int i = 0; i < CIRCUITPY_SYNTHIO_MAX_CHANNELS; i++) {
-        if (synth->span.note_obj[i] == note) {
+    for (int i = 0; i < synth->voice_count; i++) {
+        if (synth->voices[i].note_obj == note) {
             return i;
         }
     }
@@ -444,14 +674,48 @@ static int find_channel_with_note(synthio_synth_t *synth, mp_obj_t note) {
     if (note == SYNTHIO_SILENCE) {
         // replace the releasing note with lowest volume level
         int level = 32768;
-        for (int chan = 0; chan < CIRCUITPY_SYNTHIO_MAX_CHANNELS; chan++) {
+        for (int chan = 0; chan < synth->voice_count; chan++) {
             if (!SYNTHIO_NOTE_IS_PLAYING(synth, chan)) {
-                synthio_envelope_state_t *state = &synth->envelope_state[chan];
+                synthio_envelope_state_t *state = &synth->voices[chan].envelope_state;
+                if (state->level < level) {
+                    result = chan;
+                    level = state->level;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+// Every voice holds a note that hasn't been released, so take one according to
+// the synthesizer's voice stealing policy, or return -1 to drop the new note.
+static int find_channel_to_steal(synthio_synth_t *synth) {
+    int result = -1;
+    switch (synth->voice_stealing) {
+        case SYNTHIO_VOICE_STEALING_NONE:
+            break;
+        case SYNTHIO_VOICE_STEALING_OLDEST: {
+            uint32_t age = 0;
+            for (int chan = 0; chan < synth->voice_count; chan++) {
+                // press_count may have wrapped around, but the difference is still right
+                uint32_t chan_age = synth->press_count - synth->voices[chan].press_count;
+                if (result == -1 || chan_age > age) {
+                    result = chan;
+                    age = chan_age;
+                }
+            }
+            break;
+        }
+        case SYNTHIO_VOICE_STEALING_QUIETEST: {
+            int level = 32768;
+            for (int chan = 0; chan < synth->voice_count; chan++) {
+                synthio_envelope_state_t *state = &synth->voices[chan].envelope_state;
                 if (state->level < level) {
                     result = chan;
                     level = state->level;
                 }
             }
+            break;
         }
     }
     return result;
@@ -461,17 +725,23 @@ bool synthio_span_change_note(synthio_synth_t *synth, mp_obj_t old_note, mp_obj_
     int channel;
     if (new_note != SYNTHIO_SILENCE && (channel = find_channel_with_note(synth, new_note)) != -1) {
         // note already playing, re-enter attack phase
-        synth->envelope_state[channel].state = SYNTHIO_ENVELOPE_STATE_ATTACK;
+        synth->voices[channel].envelope_state.state = SYNTHIO_ENVELOPE_STATE_ATTACK;
         return true;
     }
     channel = find_channel_with_note(synth, old_note);
+    if (channel == -1 && old_note == SYNTHIO_SILENCE && new_note != SYNTHIO_SILENCE) {
+        channel = find_channel_to_steal(synth);
+    }
     if (channel != -1) {
+        synthio_voice_t *voice = &synth->voices[channel];
         if (new_note == SYNTHIO_SILENCE) {
-            synthio_envelope_state_release(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, old_note));
+            synthio_envelope_state_release(&voice->envelope_state, synthio_synth_get_note_envelope(synth, old_note));
         } else {
-            synth->span.note_obj[channel] = new_note;
-            synthio_envelope_state_init(&synth->envelope_state[channel], synthio_synth_get_note_envelope(synth, new_note));
-            synth->accum[channel] = 0;
+            voice->note_obj = new_note;
+            synthio_envelope_state_init(&voice->envelope_state, synthio_synth_get_note_envelope(synth, new_note));
+            voice->accum = 0;
+            voice->loudness[0] = voice->loudness[1] = 0;
+            voice->press_count = ++synth->press_count;
         }
         return true;
     }
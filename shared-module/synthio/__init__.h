@@ -11,8 +11,11 @@
 #define SYNTHIO_MAX_DUR (256)
 #define SYNTHIO_SILENCE (mp_const_none)
 #define SYNTHIO_NOTE_IS_SIMPLE(note) (mp_obj_is_small_int(note))
-#define SYNTHIO_NOTE_IS_PLAYING(synth, i) ((synth)->envelope_state[(i)].state != SYNTHIO_ENVELOPE_STATE_RELEASE)
+#define SYNTHIO_NOTE_IS_PLAYING(synth, i) ((synth)->voices[(i)].envelope_state.state != SYNTHIO_ENVELOPE_STATE_RELEASE)
+#define SYNTHIO_MAX_VOICES (255)
 #define SYNTHIO_FREQUENCY_SHIFT (16)
+#define SYNTHIO_MIPMAP_MIN_LENGTH (4)
+#define SYNTHIO_MIN_CONTROL_PERIOD (16)
 
 #define SYNTHIO_MIX_DOWN_RANGE_LOW (-28000)
 #define SYNTHIO_MIX_DOWN_RANGE_HIGH (28000)
@@ -24,7 +27,6 @@
 
 typedef struct {
     uint16_t dur;
-    mp_obj_t note_obj[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
 } synthio_midi_span_t;
 
 typedef struct {
@@ -41,6 +43,16 @@ typedef struct {
     envelope_state_e state;
 } synthio_envelope_state_t;
 
+typedef struct {
+    mp_obj_t note_obj;
+    uint32_t accum, ring_accum;
+    // value of the synthesizer's press_count when the note was started
+    uint32_t press_count;
+    synthio_envelope_state_t envelope_state;
+    // loudness at the end of the last control period, which the next one ramps from
+    int16_t loudness[2];
+} synthio_voice_t;
+
 typedef struct synthio_synth {
     audiosample_base_t base;
     uint32_t total_envelope;
@@ -52,9 +64,16 @@ typedef struct synthio_synth {
     synthio_envelope_definition_t global_envelope_definition;
     mp_obj_t waveform_obj, filter_obj, envelope_obj;
     synthio_midi_span_t span;
-    uint32_t accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
-    uint32_t ring_accum[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
-    synthio_envelope_state_t envelope_state[CIRCUITPY_SYNTHIO_MAX_CHANNELS];
+    synthio_voice_stealing_t voice_stealing;
+    uint16_t voice_count;
+    uint32_t press_count;
+    synthio_voice_t *voices;
+    // with a control rate, blocks and envelopes are evaluated every
+    // control_period samples and loudness is ramped in between; otherwise
+    // (control_rate == 0) they are evaluated once per buffer
+    uint32_t control_rate;
+    uint16_t control_period;
+    mp_obj_t blocks;
 } synthio_synth_t;
 
 typedef struct {
@@ -70,9 +89,11 @@ typedef struct {
 void synthio_synth_synthesize(synthio_synth_t *synth, uint8_t **buffer, uint32_t *buffer_length, uint8_t channel);
 void synthio_synth_deinit(synthio_synth_t *synth);
 bool synthio_synth_deinited(synthio_synth_t *synth);
-void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope);
+void synthio_synth_init(synthio_synth_t *synth, uint32_t sample_rate, int channel_count, mp_obj_t waveform_obj, mp_obj_t envelope, mp_int_t voice_count, mp_int_t control_rate);
 void synthio_synth_reset_buffer(synthio_synth_t *synth, bool single_channel_output, uint8_t channel);
 void synthio_synth_parse_waveform(mp_buffer_info_t *bufinfo_waveform, mp_obj_t waveform_obj);
+size_t synthio_mipmap_size(uint32_t waveform_length, uint8_t *levels);
+void synthio_mipmap_build(int16_t *dest, const int16_t *waveform, uint32_t waveform_length);
 void synthio_synth_parse_filter(mp_buffer_info_t *bufinfo_filter, mp_obj_t filter_obj);
 void synthio_synth_parse_envelope(uint16_t *envelope_sustain_index, mp_buffer_info_t *bufinfo_envelope, mp_obj_t envelope_obj, mp_obj_t envelope_hold_obj);
 
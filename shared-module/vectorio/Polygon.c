@@ -55,6 +55,9 @@ static void _clobber_points_list(vectorio_polygon_t *self, mp_obj_t points_tuple
         points_list[2 * i + 1] = (int16_t)y;
     }
 
+    self->edge_table_buffer = gc_realloc(self->edge_table_buffer, displayio_polygon_buffer_size(len), true);
+    displayio_polygon_init(&self->edge_table, points_list, len, self->edge_table_buffer);
+
     self->points_list = points_list;
     self->len = 2 * len;
 }
@@ -65,6 +68,7 @@ void common_hal_vectorio_polygon_construct(vectorio_polygon_t *self, mp_obj_t po
     VECTORIO_POLYGON_DEBUG("%p polygon_construct: ", self);
     self->points_list = NULL;
     self->len = 0;
+    self->edge_table_buffer = NULL;
     self->on_dirty.obj = NULL;
     self->color_index = color_index + 1;
     _clobber_points_list(self, points_list);
@@ -185,6 +189,19 @@ uint32_t common_hal_vectorio_polygon_get_pixel(void *obj, int16_t x, int16_t y)
     return winding_number == 0 ? 0 : self->color_index;
 }
 
+// Finds the runs covered by the polygon along shape row line, or column line when column is true.
+uint16_t common_hal_vectorio_polygon_get_spans(void *obj, bool column, int16_t line, const int16_t **spans, uint32_t *value) {
+    vectorio_polygon_t *self = obj;
+    *value = self->color_index;
+    if (self->len == 0) {
+        return 0;
+    }
+    if (column) {
+        return displayio_polygon_get_column_spans(&self->edge_table, line, spans);
+    }
+    return displayio_polygon_get_row_spans(&self->edge_table, line, spans);
+}
+
 mp_obj_t common_hal_vectorio_polygon_get_draw_protocol(void *polygon) {
     vectorio_polygon_t *self = polygon;
     return self->draw_protocol_instance;
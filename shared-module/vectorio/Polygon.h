@@ -9,6 +9,7 @@
 #include <stdint.h>
 
 #include "py/obj.h"
+#include "shared-module/displayio/polygon.h"
 #include "shared-module/vectorio/__init__.h"
 
 typedef struct {
@@ -16,6 +17,9 @@ typedef struct {
     // An int array[ x, y, ... ]
     int16_t *points_list;
     uint16_t len;
+    // Edge table built from points_list for filling spans.
+    displayio_polygon_t edge_table;
+    uint8_t *edge_table_buffer;
     uint16_t color_index;
     vectorio_event_t on_dirty;
     mp_obj_t draw_protocol_instance;
@@ -326,6 +326,22 @@ void common_hal_vectorio_vector_shape_set_pixel_shader(vectorio_vector_shape_t *
     common_hal_vectorio_vector_shape_set_dirty(self);
 }
 
+// Returns value if position is in one of the [start, end) spans and 0 otherwise. Positions must
+// move by step each call so that *span only needs to move forward. Spans are visited from the
+// last when step is negative.
+static inline uint32_t _span_pixel(const int16_t *spans, uint16_t span_count, uint16_t *span, int16_t position, int16_t step, uint32_t value) {
+    if (step > 0) {
+        while (*span < span_count && position >= spans[2 * *span + 1]) {
+            (*span)++;
+        }
+        return *span < span_count && position >= spans[2 * *span] ? value : 0;
+    }
+    while (*span < span_count && position < spans[2 * (span_count - 1 - *span)]) {
+        (*span)++;
+    }
+    return *span < span_count && position < spans[2 * (span_count - 1 - *span) + 1] ? value : 0;
+}
+
 bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displayio_colorspace_t *colorspace, const displayio_area_t *area, uint32_t *mask, uint32_t *buffer) {
     // Shape areas are relative to 0,0.  This will allow rotation about a known axis.
     //   The consequence is that the area reported by the shape itself is _relative_ to 0,0.
@@ -373,9 +389,29 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
     displayio_area_t shape_area;
     self->ishape.get_area(self->ishape.shape, &shape_area);
 
+    // Screen rows run along shape rows, or shape columns when transposed, in the direction of dx.
+    bool transpose_xy = self->absolute_transform->transpose_xy;
+    int16_t shape_step = self->absolute_transform->dx < 1 ? -1 : 1;
+
     uint16_t mask_start_px = line_dirty_offset_px;
     for (input_pixel.y = overlap.y1; input_pixel.y < overlap.y2; ++input_pixel.y) {
         mask_start_px += column_dirty_offset_px;
+
+        // Shapes that provide spans only compute which pixels they cover once per row.
+        const int16_t *spans = NULL;
+        int32_t span_count = -1;
+        uint32_t span_value = 0;
+        uint16_t span = 0;
+        int16_t shape_start = 0;
+        if (self->ishape.get_spans != NULL) {
+            int16_t shape_x;
+            int16_t shape_y;
+            screen_to_shape_coordinates(self, overlap.x1, input_pixel.y, &shape_x, &shape_y);
+            span_count = self->ishape.get_spans(self->ishape.shape, transpose_xy,
+                transpose_xy ? shape_x : shape_y, &spans, &span_value);
+            shape_start = transpose_xy ? shape_y : shape_x;
+        }
+
         for (input_pixel.x = overlap.x1; input_pixel.x < overlap.x2; ++input_pixel.x) {
             // Check the mask first to see if the pixel has already been set.
             uint16_t pixel_index = mask_start_px + (input_pixel.x - overlap.x1);
@@ -388,16 +424,21 @@ bool vectorio_vector_shape_fill_area(vectorio_vector_shape_t *self, const _displ
             }
             output_pixel.pixel = 0;
 
-            // Cast input screen coordinates to shape coordinates to pick the pixel to draw
-            int16_t pixel_to_get_x;
-            int16_t pixel_to_get_y;
-            screen_to_shape_coordinates(self, input_pixel.x, input_pixel.y, &pixel_to_get_x, &pixel_to_get_y);
-
-            VECTORIO_SHAPE_PIXEL_DEBUG(" get_pixel %p (%3d, %3d) -> ( %3d, %3d )", self->ishape.shape, input_pixel.x, input_pixel.y, pixel_to_get_x, pixel_to_get_y);
             #ifdef VECTORIO_PERF
             uint64_t pre_pixel = common_hal_time_monotonic_ns();
             #endif
-            input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
+            if (span_count >= 0) {
+                input_pixel.pixel = _span_pixel(spans, span_count, &span,
+                    shape_start + shape_step * (input_pixel.x - overlap.x1), shape_step, span_value);
+            } else {
+                // Cast input screen coordinates to shape coordinates to pick the pixel to draw
+                int16_t pixel_to_get_x;
+                int16_t pixel_to_get_y;
+                screen_to_shape_coordinates(self, input_pixel.x, input_pixel.y, &pixel_to_get_x, &pixel_to_get_y);
+
+                VECTORIO_SHAPE_PIXEL_DEBUG(" get_pixel %p (%3d, %3d) -> ( %3d, %3d )", self->ishape.shape, input_pixel.x, input_pixel.y, pixel_to_get_x, pixel_to_get_y);
+                input_pixel.pixel = self->ishape.get_pixel(self->ishape.shape, pixel_to_get_x, pixel_to_get_y);
+            }
             #ifdef VECTORIO_PERF
             uint64_t post_pixel = common_hal_time_monotonic_ns();
             pixel_time += post_pixel - pre_pixel;
@@ -16,6 +16,9 @@
 
 typedef void get_area_function(mp_obj_t shape, displayio_area_t *out_area);
 typedef uint32_t get_pixel_function(mp_obj_t shape, int16_t x, int16_t y);
+// Finds the runs of pixels covered by the shape along shape row line, or column line when column
+// is true. Runs are [start, end) pairs in *spans that all have the pixel value *value.
+typedef uint16_t get_spans_function(mp_obj_t shape, bool column, int16_t line, const int16_t **spans, uint32_t *value);
 
 // This struct binds a shape's common Shape support functions (its vector shape interface)
 //   to its instance pointer.  We only check at construction time what the type of the
@@ -27,6 +30,7 @@ typedef struct {
     mp_obj_t shape;
     get_area_function *get_area;
     get_pixel_function *get_pixel;
+    get_spans_function *get_spans; // Optional. Used instead of get_pixel to fill areas.
 } vectorio_ishape_t;
 
 typedef struct {
@@ -0,0 +1,46 @@
+import array
+from audiocore import RawSample, get_buffer
+from audiomixer import Mixer
+
+values = [0, 1000, -1000, 32767, -32768, 20000, -20000, 12345]
+
+
+def mix(bits_per_sample, samples_signed, channel_count, sample_channels, levels, panning=0.0):
+    if bits_per_sample == 16:
+        typecode = "h" if samples_signed else "H"
+        data = [v if samples_signed else v + 32768 for v in values]
+    else:
+        typecode = "b" if samples_signed else "B"
+        data = [(v >> 8) if samples_signed else (v >> 8) + 128 for v in values]
+    sample = RawSample(
+        array.array(typecode, data * sample_channels),
+        channel_count=sample_channels,
+        sample_rate=8000,
+    )
+    mixer = Mixer(
+        voice_count=len(levels),
+        channel_count=channel_count,
+        sample_rate=8000,
+        bits_per_sample=bits_per_sample,
+        samples_signed=samples_signed,
+        buffer_size=len(values) * channel_count * bits_per_sample // 4,
+    )
+    for i, level in enumerate(levels):
+        mixer.voice[i].level = level
+        mixer.voice[i].panning = panning
+        mixer.voice[i].play(sample, loop=True)
+    buffer = get_buffer(mixer)[1]
+    print(bits_per_sample, samples_signed, channel_count, sample_channels, levels, panning)
+    print(" ", list(buffer[: len(values) * channel_count]))
+
+
+for bits_per_sample in (16, 8):
+    for samples_signed in (True, False):
+        mix(bits_per_sample, samples_signed, 1, 1, [1.0])
+        mix(bits_per_sample, samples_signed, 1, 1, [0.5, 0.25])
+        mix(bits_per_sample, samples_signed, 2, 2, [0.75, 0.75])
+        mix(bits_per_sample, samples_signed, 2, 1, [0.5, 1.0])
+
+# Panning scales each side separately
+mix(16, True, 2, 1, [1.0], -0.5)
+mix(16, True, 2, 1, [1.0], 0.5)
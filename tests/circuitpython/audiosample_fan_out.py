@@ -0,0 +1,42 @@
+import array
+from audiocore import get_buffer
+from audiodelays import Echo
+from audiofilters import Filter
+from audiomixer import Mixer
+from synthio import Synthesizer, LFO
+
+# The LFO advances once each time the synthesizer fills a buffer
+synth = Synthesizer(sample_rate=8000)
+counter = LFO(array.array("h", [0, 32767]), rate=8000 / 256 / 100, once=True)
+synth.blocks.append(counter)
+synth.press(60)
+
+
+def synth_buffers():
+    return round(counter.value * 100)
+
+
+settings = dict(sample_rate=8000, channel_count=1, bits_per_sample=16, samples_signed=True)
+echo = Echo(max_delay_ms=100, buffer_size=512, **settings)
+filter = Filter(buffer_size=512, **settings)
+mixer = Mixer(voice_count=2, **settings)
+
+# Each effect pulls one buffer from the synthesizer when it starts playing
+echo.play(synth, loop=True)
+filter.play(synth, loop=True)
+mixer.voice[0].play(echo, loop=True)
+mixer.voice[1].play(filter, loop=True)
+start = synth_buffers()
+print(start)
+
+# Both effects use the same buffer from the synthesizer, so it fills one
+# buffer per mixer buffer, after the ones pulled when the effects started
+for _ in range(10):
+    get_buffer(mixer)
+print(synth_buffers() - start)
+
+# A sample pulled twice by the same effect still advances
+start = synth_buffers()
+get_buffer(synth)
+get_buffer(synth)
+print(synth_buffers() - start)
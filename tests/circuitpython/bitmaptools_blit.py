@@ -0,0 +1,61 @@
+import displayio
+import bitmaptools
+
+seed = 1
+
+
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return (seed >> 8) % n
+
+
+def fill(bitmap, bits):
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            bitmap[x, y] = rand(min(4, 1 << bits)) if rand(3) == 0 else rand(1 << bits)
+
+
+def checksum(bitmap):
+    total = 0
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            total = (total * 31 + bitmap[x, y]) & 0xFFFFFF
+    return total
+
+
+def blit(dest, source, skip_source, skip_dest):
+    x1 = rand(source.width)
+    y1 = rand(source.height)
+    x2 = x1 + rand(source.width - x1 + 1)
+    y2 = y1 + rand(source.height - y1 + 1)
+    x = rand(dest.width + 1)
+    y = rand(dest.height + 1)
+    kwargs = {}
+    if skip_source:
+        kwargs["skip_source_index"] = rand(4)
+    if skip_dest:
+        kwargs["skip_dest_index"] = rand(4)
+    bitmaptools.blit(dest, source, x, y, x1=x1, y1=y1, x2=x2, y2=y2, **kwargs)
+
+
+depths = (1, 2, 4, 8, 16)
+for source_bits in depths:
+    for dest_bits in depths:
+        if dest_bits < source_bits:
+            continue
+        source = displayio.Bitmap(37, 11, 1 << source_bits)
+        dest = displayio.Bitmap(45, 13, 1 << dest_bits)
+        fill(source, source_bits)
+        fill(dest, dest_bits)
+        for i in range(12):
+            blit(dest, source, i & 1, i & 2)
+        print(source_bits, dest_bits, checksum(dest))
+
+# Blitting a bitmap onto itself copies from the area as it was before the blit.
+for bits in depths:
+    bitmap = displayio.Bitmap(41, 9, 1 << bits)
+    fill(bitmap, bits)
+    for i in range(12):
+        blit(bitmap, bitmap, i & 1, i & 2)
+    print(bits, checksum(bitmap))
@@ -0,0 +1,60 @@
+import array
+import displayio
+import bitmaptools
+import vectorio
+
+
+def show(bitmap):
+    for y in range(bitmap.height):
+        print("".join(str(bitmap[x, y]) for x in range(bitmap.width)))
+    print()
+
+
+bitmap = displayio.Bitmap(12, 10, 4)
+bitmaptools.fill_polygon(bitmap, bytes([1, 10, 10, 3]), bytes([1, 2, 9, 7]), 1)
+show(bitmap)
+
+# Overlapping loops stay filled with the non-zero winding rule.
+bitmap.fill(0)
+xs = array.array("h", [1, 10, 10, 4, 4, 7, 7, 1])
+ys = array.array("h", [1, 1, 8, 8, 3, 3, 6, 6])
+bitmaptools.fill_polygon(bitmap, xs, ys, 2)
+show(bitmap)
+
+# Points off the bitmap are clipped.
+bitmap.fill(0)
+bitmaptools.fill_polygon(bitmap, array.array("h", [-20, 30, 6]), array.array("h", [-5, 4, 30]), 3)
+show(bitmap)
+
+# Matches vectorio.Polygon pixel for pixel.
+seed = 3
+
+
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return (seed >> 8) % n
+
+
+palette = displayio.Palette(1)
+mismatches = 0
+for i in range(40):
+    count = 3 + rand(8)
+    xs = array.array("h", [rand(30) - 3 for _ in range(count)])
+    ys = array.array("h", [rand(20) - 3 for _ in range(count)])
+    bitmap = displayio.Bitmap(24, 16, 2)
+    bitmaptools.fill_polygon(bitmap, xs, ys, 1)
+    polygon = vectorio.Polygon(pixel_shader=palette, points=list(zip(xs, ys)), x=0, y=0)
+    for y in range(bitmap.height):
+        for x in range(bitmap.width):
+            if bitmap[x, y] != polygon.contains(x, y):
+                mismatches += 1
+print("mismatches", mismatches)
+
+# Edge crossings far from the clip region must not overflow
+bitmap = displayio.Bitmap(8, 8, 2)
+xs = array.array("h", [-32768, 32767, -32768])
+ys = array.array("h", [-32768, 32767, 32767])
+bitmaptools.fill_polygon(bitmap, xs, ys, 1)
+for y in range(bitmap.height):
+    print("".join(str(bitmap[x, y]) for x in range(bitmap.width)))
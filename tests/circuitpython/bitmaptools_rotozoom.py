@@ -0,0 +1,37 @@
+import math
+import displayio
+import bitmaptools
+
+
+def show(bitmap):
+    for y in range(bitmap.height):
+        print(" ".join("%4x" % bitmap[x, y] for x in range(bitmap.width)))
+    print()
+
+
+source = displayio.Bitmap(4, 3, 16)
+for y in range(source.height):
+    for x in range(source.width):
+        source[x, y] = y * source.width + x
+
+# Nearest neighbor at a quarter turn, double size and with a skipped index.
+for angle, scale, skip_index in ((0, 1, None), (math.pi / 2, 1, None), (0, 2, None), (0, 1, 5)):
+    dest = displayio.Bitmap(10, 8, 16)
+    dest.fill(15)
+    bitmaptools.rotozoom(
+        dest, source, ox=5, oy=4, angle=angle, scale=scale, skip_index=skip_index
+    )
+    show(dest)
+
+# Bilinear blends RGB565 neighbors in each channel.
+source = displayio.Bitmap(2, 2, 65536)
+source[0, 0] = 0x0000
+source[1, 0] = 0xF800
+source[0, 1] = 0x07E0
+source[1, 1] = 0xFFFF
+dest = displayio.Bitmap(4, 4, 65536)
+bitmaptools.rotozoom(dest, source, ox=0, oy=0, px=0, py=0, scale=2, bilinear=True)
+show(dest)
+dest.fill(0x1234)
+bitmaptools.rotozoom(dest, source, ox=0, oy=0, px=0, py=0, scale=2, skip_index=0, bilinear=True)
+show(dest)
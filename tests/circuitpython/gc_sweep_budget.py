@@ -0,0 +1,63 @@
+import gc
+
+try:
+    gc.sweep_budget
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+seed = 3
+
+
+def rand(n):
+    global seed
+    seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF
+    return (seed >> 8) % n
+
+
+def make(k):
+    # Mix of small objects that point at each other and larger buffers.
+    kind = rand(4)
+    if kind == 0:
+        return [k, (k, str(k)), {"k": k}]
+    if kind == 1:
+        return bytearray([k & 255]) * (1 + rand(300))
+    if kind == 2:
+        return {str(i): [k] * i for i in range(rand(6))}
+    return (k, [k] * rand(40))
+
+
+def check(k, obj):
+    if isinstance(obj, list):
+        return obj[0] == k and obj[1] == (k, str(k)) and obj[2]["k"] == k
+    if isinstance(obj, bytearray):
+        return obj[0] == k & 255 and obj[-1] == k & 255
+    if isinstance(obj, dict):
+        return all(v == [k] * int(i) for i, v in obj.items())
+    return obj[0] == k and all(v == k for v in obj[1])
+
+
+old_budget = gc.sweep_budget()
+print(old_budget >= 0)
+for budget in (0, 16, 512, 8192):
+    gc.sweep_budget(budget)
+    print(gc.sweep_budget())
+    slots = [None] * 200
+    keys = [0] * len(slots)
+    bad = 0
+    for i in range(6000):
+        j = rand(len(slots))
+        if slots[j] is not None and not check(keys[j], slots[j]):
+            bad += 1
+        keys[j] = i
+        slots[j] = make(i)
+    for j in range(len(slots)):
+        if slots[j] is not None and not check(keys[j], slots[j]):
+            bad += 1
+    print(budget, bad)
+
+try:
+    gc.sweep_budget(-1)
+except ValueError:
+    print("ValueError")
+gc.sweep_budget(old_budget)
@@ -0,0 +1,105 @@
+# Attribute, method and global loads must see changes made after the same
+# instruction has already run.
+
+
+class Base:
+    def name(self):
+        return "base"
+
+
+class Child(Base):
+    def __init__(self):
+        self.value = 1
+
+
+def load(obj):
+    return obj.name(), obj.name
+
+
+def value(obj):
+    return obj.value
+
+
+c = Child()
+for i in range(3):
+    print(load(c)[0], value(c))
+
+# Methods added to a subclass or changed in a base class.
+Child.name = lambda self: "child"
+print(load(c)[0])
+del Child.name
+print(load(c)[0])
+Base.name = lambda self: "new base"
+print(load(c)[0])
+
+# Instance members shadow methods.
+c.name = lambda: "member"
+print(load(c)[0])
+del c.name
+print(load(c)[0])
+
+# Members that move to another slot or go away.
+for i in range(20):
+    setattr(c, "x%d" % i, i)
+print(value(c))
+c.value = 2
+print(value(c))
+del c.value
+try:
+    value(c)
+except AttributeError:
+    print("AttributeError")
+Child.value = 3
+print(value(c))
+
+# Another object at the same instruction.
+print(value(Child()), load(Base())[0])
+
+
+class Other:
+    value = "other"
+
+    def name(self):
+        return "other"
+
+
+print(value(Other()), load(Other())[0])
+
+# Methods of builtin types, with a subclass that shadows one.
+def append(seq):
+    seq.append(1)
+    return seq
+
+
+class List(list):
+    def append(self, x):
+        super().append(x * 10)
+
+
+print(append([]), append(List()), append([]))
+
+# Globals that change or are deleted, falling back to builtins.
+g = 1
+
+
+def get_g():
+    return g
+
+
+print(get_g())
+g = 2
+print(get_g())
+for i in range(20):
+    globals()["global_%d" % i] = i
+print(get_g())
+
+len = lambda x: "global len"
+
+
+def call_len():
+    return len([1, 2])
+
+
+print(call_len())
+del len
+print(call_len())
@@ -0,0 +1,60 @@
+# Test dicts with many keys being added and removed, including keys that
+# aren't qstrs and keys that are equal but not the same object.
+
+d = {}
+for i in range(300):
+    d["key%d" % i] = i
+print(len(d), d["key0"], d["key150"], d["key299"])
+
+# Remove every other key, then check the rest are still found.
+for i in range(0, 300, 2):
+    del d["key%d" % i]
+print(len(d), "key0" in d, "key1" in d, d["key299"])
+print(all(d["key%d" % i] == i for i in range(1, 300, 2)))
+
+# Add and remove in turn so that holes are reused.
+for i in range(1000):
+    d["tmp"] = i
+    del d["tmp"]
+print(len(d), "tmp" in d)
+
+# Tuples as keys.
+t = {}
+for x in range(20):
+    for y in range(20):
+        t[(x, y)] = x * y
+print(len(t), t[(3, 4)], t[(19, 19)], (20, 0) in t)
+for x in range(20):
+    del t[(x, x)]
+print(len(t), (5, 5) in t, t[(5, 6)])
+
+# Keys that compare equal.
+m = {1: "int"}
+m[1.0] = "float"
+m[True] = "bool"
+print(m)
+
+# popitem, copy and clear.
+p = {}
+for i in range(50):
+    p[str(i)] = i
+c = p.copy()
+total = 0
+while p:
+    k, v = p.popitem()
+    total += v
+    assert k not in p
+print(total, len(p), len(c), c["49"])
+c["new"] = 1
+print(len(c), sorted(c.keys())[:3])
+c.clear()
+c["a"] = 1
+print(c)
+
+# Globals are a map too.
+for i in range(10):
+    try:
+        raise ValueError(i)
+    except ValueError as e:
+        pass
+print("e" in globals())
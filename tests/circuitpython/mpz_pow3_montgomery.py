@@ -0,0 +1,24 @@
+# Test pow() with 3 arguments for odd moduli, which use Montgomery
+# multiplication, and for even and negative ones, which don't.
+
+m = 2**2048 - 1557  # odd
+e = 2**2047 + 12345
+b = 3**1200
+
+print(pow(b, e, m) % 1000003)
+print(pow(b, 65537, m) % 1000003)
+print(pow(-b, 65537, m) % 1000003)
+print(pow(b + m, 3, m) == pow(b, 3, m))
+print(pow(m, e, m), pow(m - 1, e, m) == m - 1, pow(m + 1, e, m))
+print(pow(2, 1, m), pow(2, 2, m), pow(2, 4096, m) % 1000003)
+
+# Moduli of one digit, and around digit boundaries.
+for mod in (3, 7, 65535, 65537, 2**31 - 1, 2**32 + 1, 2**64 - 59, 2**64 + 13):
+    print(mod, pow(12345678901234567890, 2**100 + 7, mod), pow(-7, 12345, mod))
+
+# Fermat's little theorem for a prime modulus.
+p = 2**521 - 1
+print(all(pow(a, p - 1, p) == 1 for a in (2, 3, 10**100, p - 2)))
+
+# Even and negative moduli.
+print(pow(b, e, m + 1) % 1000003, pow(b, e, 2**200), pow(b, e, -m) % 1000003)
@@ -0,0 +1,25 @@
+# Test big integer multiplication, division and conversion to strings at sizes
+# that use the Karatsuba, Toom-3 and recursive algorithms.
+
+x = 3**20000
+y = 7**9000 + 12345
+z = -(5**7000)
+
+# Multiplication, including operands of different sizes and squaring.
+for a, b in ((x, y), (y, z), (x, x), (z, z), (x, 11**500), (y >> 3000, y)):
+    p = a * b
+    print(p % 1000003, p.bit_length(), p == b * a)
+
+# Division, checked against multiplication.
+for a, b in ((x * y + 17, y), (x, z), (z * z * z, y >> 5000), (x, x - 1), (-x, 13**2000)):
+    q, r = divmod(a, b)
+    print(q % 1000003, r % 1000003, q * b + r == a, 0 <= r < b or b < r <= 0)
+
+# Conversion to strings in several bases.
+for a in (x, z, y * y, 10**9000, 10**9000 - 1):
+    s = str(a)
+    print(len(s), s[:12], s[-12:], int(s) == a)
+    print(hex(a)[-8:], oct(a)[:10], len("{:,}".format(a)))
+
+# Modular exponentiation uses multiplication and division.
+print(pow(y, 65537, x + 2) % 1000003)
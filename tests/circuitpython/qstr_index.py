@@ -0,0 +1,26 @@
+# Test that strings interned at runtime are found again, including many of
+# them with the same length and ones that look alike.
+
+names = ["attr_%d" % i for i in range(600)]
+
+
+class C:
+    pass
+
+
+c = C()
+for i, n in enumerate(names):
+    setattr(c, n, i)
+
+print(all(getattr(c, n) == i for i, n in enumerate(names)))
+print(all(getattr(c, "attr_" + str(i)) == i for i in range(600)))
+print(hasattr(c, "attr_600"), hasattr(c, "attr_"), hasattr(c, "attr_0"))
+
+# Keyword arguments are interned.
+d = dict(**{n: 1 for n in names[:50]})
+print(len(d), sum(d.values()))
+
+# Names that are also builtins or that differ only in their last character.
+for n in ("print", "len", "zz_qa", "zz_qb", "zz_qc"):
+    setattr(c, n, n)
+print(c.print, c.len, c.zz_qa, c.zz_qb, c.zz_qc)
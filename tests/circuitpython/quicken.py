@@ -0,0 +1,99 @@
+# Instructions specialised to the types of their operands must give the same
+# results as the generic ones when the types change.
+
+try:
+    float
+except NameError:
+    print("SKIP")
+    raise SystemExit
+
+
+def add(a, b):
+    return a + b
+
+
+def iadd(a, b):
+    a += b
+    return a
+
+
+def sub(a, b):
+    return a - b
+
+
+def isub(a, b):
+    a -= b
+    return a
+
+
+def compare(a, b):
+    return a < b, a > b, a == b, a != b
+
+
+def mul(a, b):
+    return a * b
+
+
+def div(a, b):
+    return a / b
+
+
+def index(seq, i):
+    return seq[i]
+
+
+class List(list):
+    pass
+
+
+# Run each a few times so the first run specialises them.
+for _ in range(2):
+    print(add(1, 2), add(1 << 29, 1 << 29), add(1 << 62, 1 << 62))
+    print(add(1.5, 2), add(2, 1.5), add("a", "b"), add([1], [2]))
+    print(add(-3, 4), add(True, 1))
+    print(iadd(1, 2), iadd(1.5, 0.25), iadd([1], [2]), iadd(1 << 62, 1 << 62))
+    print(sub(5, 7), sub(-(1 << 62), 1 << 62), sub(5.5, 2), sub({1, 2}, {1}))
+    print(isub(5, 7), isub(5.5, 0.5), isub(-(1 << 62), 1 << 62))
+    print(compare(1, 2), compare(2, 2), compare(1.5, 1), compare("a", "b"))
+    print(compare(1 << 70, 1), compare(1, 1.0), compare(True, 1))
+    print(mul(1.5, 2), mul(2, 1.5), mul(3, 4), mul("ab", 2))
+    print(div(1.0, 4), div(1, 4.0), div(7, 2), div(1, 4))
+    for a, b in ((1.0, 0.0), (1, 0), (1.0, 0)):
+        try:
+            div(a, b)
+        except ZeroDivisionError:
+            print("ZeroDivisionError")
+
+l = [10, 20, 30]
+for _ in range(2):
+    print(index(l, 0), index(l, -1), index(l, 2), index((1, 2), 1), index("abc", 1))
+    print(index({"a": 1}, "a"), index(List(l), 1), index(l, slice(1, None)))
+    for i in (3, -4, 1 << 40):
+        try:
+            index(l, i)
+        except IndexError:
+            print("IndexError")
+    try:
+        index(l, "a")
+    except TypeError:
+        print("TypeError")
+
+# Loops that mix types at the same instruction.
+total = 0
+for x in (1, 2.5, 3, 1 << 40, -4, 0.5):
+    total = total + x
+print(total)
+
+
+def locals_pair():
+    a = 1
+    b = 2
+    print(a, b, a + b)
+    del b
+    try:
+        print(a, b)
+    except NameError:
+        print("NameError")
+
+
+locals_pair()
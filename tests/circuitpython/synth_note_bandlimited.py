@@ -0,0 +1,48 @@
+import array
+import math
+import audiocore
+import synthio
+
+SAMPLE_RATE = 8000
+N = 1024
+# 1125Hz is exactly 144 cycles in N samples, and its aliases fall between its harmonics
+FREQUENCY = 1125
+
+saw = array.array("h", [-32767 + 65534 * i // 256 for i in range(256)])
+
+
+def alias_fraction(samples):
+    # fraction of the signal's power that isn't at a harmonic of FREQUENCY
+    total = sum(x * x for x in samples)
+    harmonic = 0
+    h = 0
+    while h * FREQUENCY < SAMPLE_RATE / 2:
+        w = 2 * math.pi * h * FREQUENCY / SAMPLE_RATE
+        re = sum(x * math.cos(w * i) for i, x in enumerate(samples))
+        im = sum(x * math.sin(w * i) for i, x in enumerate(samples))
+        harmonic += (2 if h else 1) * (re * re + im * im) / N
+        h += 1
+    return 1 - harmonic / total
+
+
+def play(note, **kw):
+    s = synthio.Synthesizer(sample_rate=SAMPLE_RATE, **kw)
+    s.press(note)
+    samples = []
+    while len(samples) < N:
+        samples.extend(audiocore.get_buffer(s)[1])
+    return samples[:N]
+
+
+n = synthio.Note(FREQUENCY, waveform=saw)
+print(n.bandlimited)
+print(alias_fraction(play(n)) < 0.02)
+
+n.bandlimited = True
+print(n.bandlimited)
+print(alias_fraction(play(n)) < 0.02)
+
+# a band-limited note using the synthesizer's waveform
+n = synthio.Note(FREQUENCY, bandlimited=True)
+print(n.bandlimited, n.waveform)
+print(alias_fraction(play(n, waveform=saw)) < 0.02)
@@ -0,0 +1,50 @@
+import array
+from audiocore import get_buffer
+from synthio import Synthesizer, Note, Envelope, LFO
+
+# a constant waveform, so that the output follows the loudness of the note
+dc = array.array("h", [16384, 16384])
+triangle = array.array("h", [0, 32767, 0, -32767])
+
+
+def largest_step(synth, n, last=0):
+    result = 0
+    for _ in range(n):
+        for sample in memoryview(get_buffer(synth)[1]).cast("h"):
+            result = max(result, abs(sample - last))
+            last = sample
+    return result, last
+
+
+print(Synthesizer().control_rate)
+print(Synthesizer(sample_rate=8000, control_rate=500).control_rate)
+for rate in (0, 8001):
+    try:
+        Synthesizer(sample_rate=8000, control_rate=rate)
+    except ValueError:
+        print("ValueError", rate)
+
+envelope = Envelope(attack_time=0.1, decay_time=0.05, release_time=0.2, sustain_level=0.8)
+for control_rate in (None, 500, 8000):
+    synth = Synthesizer(sample_rate=8000, waveform=dc, envelope=envelope, control_rate=control_rate)
+    synth.press(Note(100))
+    attack, last = largest_step(synth, 4)
+    synth.release_all()
+    release, last = largest_step(synth, 8, last)
+    print(control_rate, attack, release)
+
+for control_rate in (None, 500):
+    synth = Synthesizer(sample_rate=8000, waveform=dc, control_rate=control_rate)
+    tremolo = LFO(triangle, rate=8, scale=0.5, offset=0.5)
+    synth.press(Note(100, amplitude=tremolo))
+    _, last = largest_step(synth, 1)
+    print(control_rate, largest_step(synth, 16, last)[0])
+
+# free-running blocks advance at the same speed whatever the control rate
+for control_rate in (None, 500):
+    synth = Synthesizer(sample_rate=8000, control_rate=control_rate)
+    ramp = LFO(array.array("h", [0, 32767]), rate=1, once=True)
+    synth.blocks.append(ramp)
+    for _ in range(16):
+        get_buffer(synth)
+    print(control_rate, round(ramp.value, 3))
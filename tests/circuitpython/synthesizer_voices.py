@@ -0,0 +1,37 @@
+from synthio import Synthesizer, Note, Envelope, VoiceStealing
+from audiocore import get_buffer
+
+s = Synthesizer()
+print(s.voices == s.max_polyphony, s.voice_stealing)
+
+for v in (0, 256):
+    try:
+        Synthesizer(voices=v)
+    except ValueError:
+        print("ValueError", v)
+
+loud = Envelope(attack_time=0, decay_time=0, sustain_level=0.8, release_time=0.1)
+quiet = Envelope(attack_time=0, decay_time=0, sustain_level=0.2, release_time=0.1)
+notes = [Note(220 * (i + 1), envelope=quiet if i == 1 else loud) for i in range(4)]
+
+
+def show(s):
+    print(s.voices, s.voice_stealing, [notes.index(n) for n in s.pressed])
+
+
+for stealing in (VoiceStealing.NONE, VoiceStealing.OLDEST, VoiceStealing.QUIETEST):
+    s = Synthesizer(voices=3, voice_stealing=stealing)
+    for n in notes[:3]:
+        s.press(n)
+        get_buffer(s)
+    s.press(notes[3])
+    show(s)
+
+s = Synthesizer(voices=2, voice_stealing=VoiceStealing.NONE)
+s.press(notes[:2])
+s.voice_stealing = VoiceStealing.OLDEST
+s.press(notes[2])
+show(s)
+s.release(notes[1])
+s.press(notes[3])
+show(s)
@@ -0,0 +1,32 @@
+# check that gc.mem_free() and gc.mem_alloc() don't change when the heap is unlocked,
+# including while a sweep after an automatic collection is still pending
+
+import gc, micropython
+
+try:
+    micropython.heap_lock
+    gc.mem_free
+except AttributeError:
+    print("SKIP")
+    raise SystemExit
+
+
+def test():
+    keep = [None] * 500
+    mismatch = 0
+    for i in range(20000):
+        keep[i % 500] = [i] * 8
+        junk = bytearray(300)
+        if i % 37 == 0:
+            micropython.heap_lock()
+            free = gc.mem_free()
+            alloc = gc.mem_alloc()
+            micropython.heap_unlock()
+            changed = free != gc.mem_free() or alloc != gc.mem_alloc()
+            # The first few times round may allocate caches for the code.
+            if changed and i > 1000:
+                mismatch += 1
+    print(mismatch)
+
+
+test()
@@ -0,0 +1,52 @@
+# Mix 8 looping voices into a 16-bit stereo 44.1kHz audiomixer.Mixer, half of
+# them from mono samples, pulling buffers the way an audio output would.
+
+try:
+    import array, audiocore, audiomixer
+
+    get_buffer = audiocore.get_buffer
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+VOICES = 8
+SAMPLE_RATE = 44100
+
+
+def make_sample(channel_count, period):
+    data = array.array("h", [0] * (period * channel_count * 16))
+    for i in range(len(data)):
+        data[i] = ((i * 997) % 65536) - 32768
+    return audiocore.RawSample(data, channel_count=channel_count, sample_rate=SAMPLE_RATE)
+
+
+def bm_setup(params):
+    nbuf, buffer_size = params
+    mixer = audiomixer.Mixer(
+        voice_count=VOICES,
+        channel_count=2,
+        sample_rate=SAMPLE_RATE,
+        buffer_size=buffer_size,
+    )
+    samples = [make_sample(1 + (v & 1), 61 + v) for v in range(VOICES)]
+    for v in range(VOICES):
+        mixer.voice[v].level = 0.5
+        mixer.play(samples[v], voice=v, loop=True)
+
+    def run():
+        for _ in range(nbuf):
+            get_buffer(mixer)
+
+    def result():
+        # Thousands of voice-frames mixed
+        return nbuf * buffer_size // 8 * VOICES // 1000, None
+
+    return run, result
+
+
+bm_params = {
+    (50, 10): (20, 4096),
+    (100, 10): (40, 4096),
+    (1000, 10): (400, 4096),
+    (5000, 10): (2000, 4096),
+}